@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+'''
+    engines.py
+
+Time autgrp() and certificate() with each search engine on the
+benchmark graph families and show the engine picked by mode='auto'.
+The thresholds of the 'auto' policy in nautywrap.h were calibrated
+with this script.
+
+Usage: PYTHONPATH=build/lib.* python3 benchmarks/engines.py [repeat]
+'''
+
+import sys
+import timeit
+
+from pynauty import autgrp, certificate, select_mode
+from families import families
+
+MODES = ['dense', 'sparse', 'traces']
+
+
+def edge_count(g):
+    edges = set()
+    for x, ys in g.adjacency_dict.items():
+        for y in ys:
+            edges.add((x, y) if g.directed or x <= y else (y, x))
+    return len(edges)
+
+
+def best_time(f, repeat):
+    return min(timeit.repeat(f, number=1, repeat=repeat))
+
+
+def main(repeat=3):
+    print('%-16s %6s %7s  %10s %10s %10s  %-7s %-7s' %
+          ('graph', 'n', 'edges', *MODES, 'fastest', 'auto'))
+    for name, g in families():
+        times = {}
+        for mode in MODES:
+            times[mode] = best_time(lambda: (autgrp(g, mode),
+                                             certificate(g, mode)), repeat)
+        fastest = min(times, key=times.get)
+        print('%-16s %6d %7d  %10.6f %10.6f %10.6f  %-7s %-7s' %
+              (name, g.number_of_vertices, edge_count(g),
+               times['dense'], times['sparse'], times['traces'],
+               fastest, select_mode(g)))
+
+
+if __name__ == '__main__':
+    main(*map(int, sys.argv[1:]))
@@ -0,0 +1,105 @@
+'''
+    families.py
+
+Graph families used by the pynauty benchmarks: the graphs of the test
+suite in src/pynauty/tests/conftest.py and random and special graphs
+in the spirit of nauty's genrang and genspecialg.
+'''
+
+import os
+import random
+import sys
+
+from pynauty import Graph
+
+TESTS_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                         os.pardir, 'src', 'pynauty', 'tests')
+
+TEST_FAMILIES = ['a35', 'a52', 'b25', 'b35', 'b52', 'bibd-91-10-1',
+                 'g13', 'g15', 'g16', 'g16b', 'g33', 'g6', 'g63',
+                 'hadamard-7-96', 'hadamard-8-96', 'levi-r']
+
+
+class _Request(object):
+    def __init__(self, param):
+        self.param = param
+
+
+def test_graph(name):
+    '''
+    Return the Graph called *name* in the test suite.
+    '''
+    sys.path.insert(0, TESTS_DIR)
+    try:
+        import conftest
+    finally:
+        sys.path.pop(0)
+    fixture = getattr(conftest.graph, '__wrapped__', None)
+    if fixture is None:
+        fixture = conftest.graph.__pytest_wrapped__.obj
+    return fixture(_Request(name))[1]
+
+
+def random_graph(n, p, seed=0):
+    '''
+    A random graph with edge probability *p*, like genrang -P.
+    '''
+    rng = random.Random(seed)
+    adjacency_dict = {}
+    for x in range(n):
+        ys = [y for y in range(x + 1, n) if rng.random() < p]
+        if ys:
+            adjacency_dict[x] = ys
+    return Graph(n, adjacency_dict=adjacency_dict)
+
+
+def random_regular(n, d, seed=0):
+    '''
+    A random d-regular multigraph with the multiple edges and loops
+    dropped, like genrang -r.
+    '''
+    rng = random.Random(seed)
+    points = [x for x in range(n) for i in range(d)]
+    rng.shuffle(points)
+    adjacency_dict = {}
+    for x, y in zip(points[0::2], points[1::2]):
+        if x != y:
+            adjacency_dict.setdefault(x, []).append(y)
+    return Graph(n, adjacency_dict=adjacency_dict)
+
+
+def cycle(n):
+    '''
+    The cycle on n vertices, like genspecialg -c.
+    '''
+    return Graph(n, adjacency_dict={x: [(x + 1) % n] for x in range(n)})
+
+
+def grid(k):
+    '''
+    The k x k grid, like genspecialg -g.
+    '''
+    adjacency_dict = {}
+    for x in range(k):
+        for y in range(k):
+            adjacency_dict[x * k + y] = (
+                ([(x + 1) * k + y] if x + 1 < k else []) +
+                ([x * k + y + 1] if y + 1 < k else []))
+    return Graph(k * k, adjacency_dict=adjacency_dict)
+
+
+def families():
+    '''
+    Yield (name, Graph) pairs of all the benchmark graphs.
+    '''
+    for name in TEST_FAMILIES:
+        yield name, test_graph(name)
+    for n in (16, 64, 256, 1024):
+        for p in (0.05, 0.5):
+            yield 'random-%d-%g' % (n, p), random_graph(n, p)
+    for n in (64, 1024, 8192):
+        yield 'regular-%d-3' % n, random_regular(n, 3)
+    for n in (100, 10000):
+        yield 'cycle-%d' % n, cycle(n)
+    for k in (10, 60):
+        yield 'grid-%d' % k, grid(k)
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+'''
+    schreier.py
+
+Time autgrp() and certificate() in 'dense' mode with and without the
+Schreier-Sims pruning of schreier=True, for several schreier_fails
+values, on the benchmark graph families with large automorphism
+groups.
+
+Usage: PYTHONPATH=build/lib.* python3 benchmarks/schreier.py [repeat]
+'''
+
+import sys
+import timeit
+
+from pynauty import autgrp, certificate
+from families import test_graph, cycle, grid
+
+FAILS = [2, 10, 50]
+
+
+def graphs():
+    for name in ['g16', 'g16b', 'hadamard-7-96', 'hadamard-8-96',
+                 'bibd-91-10-1']:
+        yield name, test_graph(name)
+    yield 'cycle-1000', cycle(1000)
+    yield 'grid-30', grid(30)
+
+
+def best_time(f, repeat):
+    return min(timeit.repeat(f, number=1, repeat=repeat))
+
+
+def main(repeat=3):
+    columns = ['off'] + ['fails=%d' % f for f in FAILS]
+    print('%-16s %6s %14s  ' % ('graph', 'n', 'order') +
+          ' '.join('%13s' % c for c in columns))
+    for name, g in graphs():
+        order = autgrp(g)[1]
+        times = [best_time(lambda: (autgrp(g), certificate(g)), repeat)]
+        for fails in FAILS:
+            times.append(best_time(
+                lambda: (autgrp(g, schreier=True, schreier_fails=fails),
+                         certificate(g, schreier=True,
+                                     schreier_fails=fails)),
+                repeat))
+        print('%-16s %6d %14.6g  ' % (name, g.number_of_vertices, order) +
+              ' '.join('%13.6f' % t for t in times))
+
+
+if __name__ == '__main__':
+    main(*map(int, sys.argv[1:]))
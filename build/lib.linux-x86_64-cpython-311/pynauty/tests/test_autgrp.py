@@ -0,0 +1,363 @@
+#!/usr/bin/env python
+
+import sys
+import time
+import array
+import threading
+from pynauty import (Graph, autgrp, analyze, canon_label, certificate,
+                     select_mode, Version)
+import pytest
+
+# List of graphs for testing
+#
+# Structure:
+#   [[name, Graph, numorbit, grpsize, generators]]
+#
+# numorbit, grpsize, generators was calculated by dreadnut
+#
+
+def test_autgrp(graph):
+    gname, g, numorbit, grpsize, gens = graph
+    print(Version())
+    print('%-17s ...' % gname, end=' ')
+    sys.stdout.flush()
+    generators, order, o2, orbits, orbit_no = autgrp(g)
+    assert generators == gens and orbit_no == numorbit and order == grpsize
+
+
+def test_autgrp_as_array(graph):
+    gname, g, numorbit, grpsize, gens = graph
+    print('Testing pynauty.autgrp(as_array=True) on %-17s ...' % gname,
+          end=' ')
+    sys.stdout.flush()
+    n = g.number_of_vertices
+    generators, order, o2, orbits, orbit_no = autgrp(g, 'auto', True)
+    view = memoryview(generators)
+    assert view.format == 'i' and view.shape == (len(generators), n)
+    assert all(sorted(p) == list(range(n)) for p in view.tolist())
+    assert memoryview(orbits).tolist() == autgrp(g, 'auto')[3]
+    assert orbit_no == numorbit and order == grpsize
+
+
+def test_autgrp_as_array_small():
+    print('Testing pynauty.autgrp(as_array=True) on small graphs')
+    path = Graph(4, adjacency_dict={0: [1], 1: [2], 2: [3]})
+    generators, order, o2, orbits, orbit_no = autgrp(path, as_array=True)
+    assert memoryview(generators).tolist() == autgrp(path)[0]
+    assert memoryview(orbits).tolist() == [0, 1, 1, 0]
+    rigid = Graph(4, adjacency_dict={0: [1], 1: [2], 2: [3]},
+                  vertex_coloring=[{0}])
+    generators = autgrp(rigid, as_array=True)[0]
+    assert len(generators) == 0
+    assert memoryview(generators).shape == (0, 4)
+    assert memoryview(generators).tolist() == []
+
+
+def test_autgrp_numpy():
+    np = pytest.importorskip('numpy')
+    print('Testing pynauty.autgrp(as_array=True) with numpy')
+    path = Graph(4, adjacency_dict={0: [1], 1: [2], 2: [3]})
+    generators = np.asarray(autgrp(path, as_array=True)[0])
+    assert generators.dtype == np.intc
+    assert generators.tolist() == autgrp(path)[0]
+
+
+@pytest.mark.parametrize('mode', ['dense', 'traces'])
+def test_on_generator(graph, mode):
+    gname, g, numorbit, grpsize, gens = graph
+    print('Testing pynauty.autgrp(on_generator=...) on %-17s ...' % gname,
+          end=' ')
+    sys.stdout.flush()
+    if mode == 'dense' and gname == 'levi-r':
+        pytest.skip('too slow for dense nauty')
+    n = g.number_of_vertices
+    streamed = []
+    r = autgrp(g, mode, on_generator=streamed.append)
+    assert r[0] == len(streamed) and r[1:] == autgrp(g, mode)[1:]
+    if mode == 'dense':
+        assert streamed == gens
+    # a ring of 3 slots keeps the last generators
+    ring = array.array('i', [-1] * (3 * n))
+    count = autgrp(g, mode, on_generator=ring)[0]
+    rows = [ring[k * n:(k + 1) * n].tolist() for k in range(3)]
+    for k in range(min(count, 3)):
+        p = rows[(count - 1 - k) % 3]
+        assert sorted(p) == list(range(n))
+        if mode == 'dense':
+            assert p == gens[count - 1 - k]
+
+
+def test_on_generator_errors():
+    print('Testing pynauty.autgrp(on_generator=...) errors')
+    g = Graph(5)
+
+    def fail(p):
+        calls.append(p)
+        raise KeyError(len(calls))
+    calls = []
+    with pytest.raises(KeyError):
+        autgrp(g, on_generator=fail)
+    assert len(calls) == 1
+    with pytest.raises(ValueError):
+        autgrp(g, on_generator=array.array('i', [0] * 4))
+    with pytest.raises(ValueError):
+        autgrp(g, on_generator=array.array('d', [0] * 5))
+    with pytest.raises(TypeError):
+        autgrp(g, on_generator=b'\0' * 20)
+
+
+@pytest.mark.parametrize('graph', ['levi-r'], indirect=True)
+def test_budget(graph):
+    gname, g, numorbit, grpsize, gens = graph
+    print('Testing the search budget of pynauty.autgrp() on %s' % gname)
+    # dense nauty needs several seconds for this one
+    start = time.time()
+    with pytest.raises(TimeoutError):
+        autgrp(g, timeout=0.2)
+    assert time.time() - start < 5
+    with pytest.raises(TimeoutError):
+        certificate(g, max_nodes=10)
+    with pytest.raises(ValueError):
+        autgrp(g, 'traces', max_nodes=10)
+    assert autgrp(g, 'traces', timeout=60)[1] == grpsize
+    # searches in other threads are not disturbed by the aborted ones
+    small = Graph(8, adjacency_dict={i: [(i + 1) % 8] for i in range(8)})
+    cert = certificate(small)
+    assert autgrp(small, 'sparse', timeout=60, max_nodes=1000)[1] == 16
+    results = []
+
+    def work():
+        for i in range(200):
+            results.append(certificate(small) == cert and
+                           autgrp(small)[1] == 16)
+    worker = threading.Thread(target=work)
+    worker.start()
+    for i in range(5):
+        with pytest.raises(TimeoutError):
+            autgrp(g, timeout=0.02)
+    worker.join()
+    assert len(results) == 200 and all(results)
+
+
+def test_budget_while_streaming():
+    print('Testing a timeout in one thread while another streams')
+    # the killer's timeout fires while its own callback sleeps, so the
+    # kill request stays up while the streaming search goes on
+    streamed = threading.Event()
+    killed = threading.Event()
+    seen = []
+    errors = []
+
+    def on_generator(perm):
+        seen.append(perm)
+        if len(seen) == 1:
+            streamed.set()
+            killed.wait(10)
+
+    def stream():
+        try:
+            autgrp(Graph(12), on_generator=on_generator)
+        except RuntimeError as e:
+            errors.append(e)
+
+    def hold(perm):
+        time.sleep(0.3)
+        killed.set()
+        time.sleep(0.3)
+
+    worker = threading.Thread(target=stream)
+    worker.start()
+    assert streamed.wait(10)
+    with pytest.raises(TimeoutError):
+        autgrp(Graph(4), timeout=0.05, on_generator=hold)
+    worker.join()
+    # no generator is passed on twice: the search stops instead
+    assert len(errors) == 1 and 'another search' in str(errors[0])
+    assert 1 <= len(seen) < 11
+    assert len(set(map(tuple, seen))) == len(seen)
+
+
+@pytest.mark.parametrize('graph', ['levi-r'], indirect=True)
+def test_budget_while_stopped(graph):
+    gname, g, numorbit, grpsize, gens = graph
+    print('Testing a timeout expiring while another search stops %s' %
+          gname)
+    # the victim is stopped by the killer's timeout, whose request stays
+    # up while the killer's callback sleeps; the victim's own timeout
+    # expires meanwhile and must end its wait
+    outcome = []
+
+    def victim():
+        start = time.time()
+        try:
+            autgrp(g, timeout=0.3)
+        except TimeoutError:
+            outcome.append(time.time() - start)
+
+    worker = threading.Thread(target=victim)
+    worker.start()
+    time.sleep(0.05)
+    with pytest.raises(TimeoutError):
+        autgrp(Graph(4), timeout=0.05, on_generator=lambda p: time.sleep(2))
+    worker.join(10)
+    assert not worker.is_alive()
+    assert len(outcome) == 1 and outcome[0] < 1.5
+
+
+def test_analyze(graph):
+    gname, g, numorbit, grpsize, gens = graph
+    print('Testing pynauty.analyze() on %-17s ...' % gname, end=' ')
+    sys.stdout.flush()
+    r = analyze(g, mode='auto')
+    generators, order, o2, orbits, orbit_no = autgrp(g, 'auto')
+    # with a canonical labeling nauty may find other generators
+    assert len(r['gens']) == r['stats'].numgenerators
+    assert r['orbits'] == orbits
+    assert r['canon'] == canon_label(g, 'auto')
+    assert r['cert'] == certificate(g, 'auto')
+    stats = r['stats']
+    assert stats.numorbits == numorbit and stats.errstatus == 0
+    assert stats.grpsize1 * 10**stats.grpsize2 == grpsize
+    assert stats.mode == select_mode(g)
+    assert stats.numnodes >= stats.maxlevel >= 1
+    assert stats.time >= 0 and stats.cpu_time >= 0
+    assert stats == tuple(stats) and len(stats) == 16
+    assert r['order'] in (grpsize, None)
+    if gname != 'levi-r':       # too slow for dense nauty
+        assert analyze(g, 'order')['order'] == grpsize
+    r = analyze(g, want=['gens', 'orbits'], mode='auto', format='hash128')
+    assert sorted(r) == ['gens', 'orbits'] and r['orbits'] == orbits
+    assert analyze(g, 'cert', 'auto', 'hash128') == \
+        {'cert': certificate(g, 'auto', 'hash128')}
+    with pytest.raises(ValueError):
+        analyze(g, want=['gens', 'automorphisms'])
+
+
+def test_group_order():
+    print('Testing the exact group order of pynauty.analyze()')
+    factorial = [1]
+    for i in range(1, 41):
+        factorial.append(factorial[-1] * i)
+    for n in (0, 1, 5, 30):
+        g = Graph(n)
+        assert analyze(g, 'order')['order'] == factorial[n]
+        assert analyze(g, 'order', 'sparse')['order'] == factorial[n]
+    # two complete graphs on 20 vertices, too large for grpsize1
+    g = Graph(40, adjacency_dict={x: [y for y in range(40) if x < y and
+                                      (x < 20) == (y < 20)]
+                                  for x in range(40)})
+    assert analyze(g, 'order')['order'] == 2 * factorial[20]**2
+    assert analyze(g, 'order', 'traces')['order'] is None
+    g.set_vertex_coloring([set(range(20))])
+    assert analyze(g, 'order')['order'] == factorial[20]**2
+    assert analyze(Graph(5), 'order', 'traces')['order'] == 120
+
+
+@pytest.mark.parametrize('invariant, mode', [('cellquads', 'dense'),
+                                             ('cellfano2', 'dense'),
+                                             ('distances', 'sparse')])
+def test_invariant(graph, invariant, mode):
+    gname, g, numorbit, grpsize, gens = graph
+    if gname == 'levi-r':
+        pytest.skip('too slow for nauty')
+    print('Testing invariant=%r on %-17s ...' % (invariant, gname), end=' ')
+    sys.stdout.flush()
+    generators, order, o2, orbits, orbit_no = autgrp(
+        g, mode, invariant=invariant, mininvarlevel=0, maxinvarlevel=2)
+    assert order == grpsize and orbit_no == numorbit
+    assert orbits == autgrp(g)[3]
+    # the certificate of a relabeled copy is the same
+    n = g.number_of_vertices
+    perm = [(7 * v + 3) % n if n % 7 else n - 1 - v for v in range(n)]
+    h = Graph(n, g.directed,
+              {perm[x]: [perm[y] for y in ys]
+               for x, ys in g.adjacency_dict.items()},
+              [set(perm[v] for v in part) for part in g.vertex_coloring])
+    assert (certificate(g, mode, invariant=invariant) ==
+            certificate(h, mode, invariant=invariant))
+    print('OK')
+
+
+def test_invariant_errors():
+    print('Testing invariant errors')
+    g = Graph(4, adjacency_dict={0: [1], 1: [2], 2: [3]})
+    with pytest.raises(ValueError):
+        autgrp(g, invariant='nonesuch')
+    with pytest.raises(ValueError):
+        autgrp(g, 'sparse', invariant='cellquads')
+    with pytest.raises(ValueError):
+        certificate(g, 'traces', invariant='distances')
+    assert autgrp(g, invariant='adjacencies')[1] == 2
+
+
+@pytest.mark.parametrize('schreier_fails', [None, 1])
+def test_schreier(graph, schreier_fails):
+    gname, g, numorbit, grpsize, gens = graph
+    if gname == 'levi-r':
+        pytest.skip('too slow for nauty')
+    print('Testing schreier=True on %-17s ...' % gname, end=' ')
+    sys.stdout.flush()
+    for mode in 'dense', 'sparse':
+        generators, order, o2, orbits, orbit_no = autgrp(
+            g, mode, schreier=True, schreier_fails=schreier_fails)
+        assert order == grpsize and orbit_no == numorbit
+        assert orbits == autgrp(g, mode)[3]
+        assert (certificate(g, mode, schreier=True,
+                            schreier_fails=schreier_fails) ==
+                certificate(g, mode))
+    print('OK')
+
+
+def refine_capsule(name):
+    # a capsule of a refinement procedure linked into the extension
+    import ctypes
+    import importlib
+    nautywrap = importlib.import_module('pynauty.nautywrap')
+    proc = getattr(ctypes.CDLL(nautywrap.__file__), name)
+    new = ctypes.pythonapi.PyCapsule_New
+    new.restype = ctypes.py_object
+    new.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_void_p]
+    return new(ctypes.cast(proc, ctypes.c_void_p), b'pynauty.userrefproc',
+               None)
+
+
+@pytest.mark.parametrize('tc_level', [0, 100])
+def test_refine(graph, tc_level):
+    gname, g, numorbit, grpsize, gens = graph
+    if gname == 'levi-r':
+        pytest.skip('too slow for nauty')
+    if gname == 'bibd-91-10-1' and tc_level < 100:
+        pytest.skip('too slow without bestcell()')
+    print('Testing tc_level=%d on %-17s ...' % (tc_level, gname), end=' ')
+    sys.stdout.flush()
+    small = g.number_of_vertices <= 32
+    for mode, refine in [('dense', None), ('dense', 'refine'),
+                         ('dense', 'refine1' if small else None),
+                         ('dense', refine_capsule('refine')),
+                         ('sparse', refine_capsule('refine_sg'))]:
+        generators, order, o2, orbits, orbit_no = autgrp(
+            g, mode, tc_level=tc_level, refine=refine)
+        assert order == grpsize and orbit_no == numorbit
+        assert orbits == autgrp(g)[3]
+    # the same refinement gives the same certificate
+    assert (certificate(g, tc_level=tc_level,
+                        refine='refine1' if small else 'refine') ==
+            certificate(g, tc_level=tc_level,
+                        refine=refine_capsule('refine')))
+    print('OK')
+
+
+def test_refine_errors():
+    print('Testing tc_level and refine errors')
+    g = Graph(4, adjacency_dict={0: [1], 1: [2], 2: [3]})
+    with pytest.raises(ValueError):
+        autgrp(g, refine='nonesuch')
+    with pytest.raises(ValueError):
+        autgrp(g, 'sparse', refine='refine1')
+    with pytest.raises(ValueError):
+        autgrp(Graph(100), refine='refine1')
+    with pytest.raises(ValueError):
+        certificate(g, 'traces', tc_level=0)
+    with pytest.raises(TypeError):
+        autgrp(g, refine=1)
+    assert autgrp(g, refine='refine1')[1] == 2
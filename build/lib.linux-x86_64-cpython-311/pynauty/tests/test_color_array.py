@@ -0,0 +1,70 @@
+#!/usr/bin/env python
+
+import array
+import random
+from pynauty import (Graph, CompactGraph, autgrp, certificate, certificates,
+                     canon_graph)
+import pytest
+
+
+def color_classes(colors):
+    parts = {}
+    for v, c in enumerate(colors):
+        parts.setdefault(c, set()).add(v)
+    return [parts[c] for c in sorted(parts)]
+
+
+@pytest.mark.parametrize('mode', ['dense', 'sparse', 'traces'])
+def test_color_array(mode):
+    print('Testing Graph vertex color arrays with mode=%s' % mode)
+    rng = random.Random(14)
+    n = 60
+    adjacency_dict = {x: [y for y in range(x + 1, n) if rng.random() < 0.1]
+                      for x in range(n)}
+    colors = [rng.choice([2, 5, 9, 200]) for v in range(n)]
+    g = Graph(n, adjacency_dict=adjacency_dict,
+              vertex_coloring=color_classes(colors))
+    arrays = [bytes(colors), bytearray(colors),
+              array.array('i', colors),
+              array.array('Q', [c << 20 for c in colors])]
+    for a in arrays:
+        h = Graph(n, adjacency_dict=adjacency_dict, vertex_coloring=a)
+        c = CompactGraph(n, False, adjacency_dict, a)
+        assert certificate(h, mode) == certificate(g, mode)
+        assert certificate(c, mode) == certificate(g, mode)
+        assert autgrp(h, mode)[1:] == autgrp(g, mode)[1:]
+        assert certificates([h, c]) == [certificate(g)] * 2
+        assert canon_graph(h).vertex_coloring == \
+            canon_graph(g).vertex_coloring
+        assert h.vertex_coloring == g.vertex_coloring
+        assert c.vertex_coloring == g.vertex_coloring
+
+
+def test_color_array_errors():
+    print('Testing Graph vertex color array errors')
+    with pytest.raises(ValueError):
+        Graph(3, vertex_coloring=bytes(4))
+    with pytest.raises(ValueError):
+        Graph(3, vertex_coloring=array.array('i', [0, -1, 1]))
+    with pytest.raises(TypeError):
+        Graph(3, vertex_coloring=array.array('d', [0, 1, 1]))
+    with pytest.raises(ValueError):
+        CompactGraph(3, vertex_coloring=bytes(2))
+    # unsigned 64 bit colors out of range are not wrapped around
+    for c in (2**63 + 1, 2**64 - 1, 2**31):
+        with pytest.raises(ValueError):
+            Graph(3, vertex_coloring=array.array('Q', [0, c, 1]))
+        with pytest.raises(ValueError):
+            CompactGraph(3, vertex_coloring=array.array('Q', [0, c, 1]))
+    assert Graph(3, vertex_coloring=bytes(3)).vertex_coloring == []
+    assert autgrp(Graph(3, vertex_coloring=bytes([1, 0, 1])))[1] == 2
+
+
+def test_numpy_colors():
+    np = pytest.importorskip('numpy')
+    print('Testing Graph vertex color arrays with numpy')
+    colors = np.array([0, 1, 0, 1, 2, 2])
+    g = Graph(6, adjacency_dict={0: [1], 2: [3], 4: [5]},
+              vertex_coloring=colors)
+    assert g.vertex_coloring == [{0, 2}, {1, 3}, {4, 5}]
+    assert autgrp(g)[1] == 4
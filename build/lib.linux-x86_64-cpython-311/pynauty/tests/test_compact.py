@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+
+import sys
+import array
+import pickle
+from pynauty import (Graph, CompactGraph, autgrp, certificate, certificates,
+                     canon_graph, isomorphic, delete_random_edge)
+import pytest
+
+
+def compact(g):
+    return CompactGraph(g.number_of_vertices, g.directed,
+                        g.adjacency_dict, g.vertex_coloring)
+
+
+def test_compact(graph):
+    gname, g, numorbit, grpsize, gens = graph
+    print('Testing pynauty.CompactGraph with %-17s ...' % gname, end=' ')
+    sys.stdout.flush()
+    c = compact(g)
+    assert c.number_of_vertices == g.number_of_vertices
+    assert c.directed == g.directed
+    assert c.vertex_coloring == g.vertex_coloring
+    assert {v: sorted(vs) for v, vs in g.adjacency_dict.items() if vs} == \
+        c.adjacency_dict
+    generators, order, o2, orbits, orbit_no = autgrp(c, 'auto')
+    assert order == grpsize and orbit_no == numorbit
+    assert orbits == autgrp(g, 'auto')[3]
+    assert certificate(c, 'auto') == certificate(g, 'auto')
+    assert certificates([c, g]) == [certificate(g)] * 2
+
+
+def test_compact_api():
+    print('Testing pynauty.CompactGraph methods')
+    g = Graph(6, adjacency_dict={0: [1, 1, 2], 3: [4]},
+              vertex_coloring=[{0, 3}, set()])
+    c = compact(g)
+    assert c.adjacency_dict == {0: [1, 2], 3: [4]}
+    assert c.vertex_coloring == [{0, 3}, set(), {1, 2, 4, 5}]
+    c.connect_vertex(5, [4, 0])
+    c.connect_vertex(2, 1)
+    g.connect_vertex(5, [4, 0])
+    g.connect_vertex(2, 1)
+    assert c.adjacency_dict == {0: [1, 2], 2: [1], 3: [4], 5: [0, 4]}
+    assert certificate(c) == certificate(g)
+    assert isomorphic(c, g)
+    h = canon_graph(c)
+    assert isinstance(h, CompactGraph) and certificate(h) == certificate(c)
+    d = c.copy()
+    assert repr(d) == repr(c) and repr(c).startswith('CompactGraph(')
+    assert pickle.loads(pickle.dumps(c)).adjacency_dict == c.adjacency_dict
+    delete_random_edge(d)
+    assert sum(map(len, d.adjacency_dict.values())) == 5
+    assert sum(map(len, c.adjacency_dict.values())) == 6
+    c.set_vertex_coloring([])
+    assert c.vertex_coloring == []
+    c.directed = True
+    assert certificate(c) != certificate(g)
+    with pytest.raises(ValueError):
+        c.connect_vertex(6, [0])
+    with pytest.raises(ValueError):
+        c.set_vertex_coloring([{0, 1}, {1}])
+    with pytest.raises(ValueError):
+        CompactGraph(3, adjacency_dict={0: [3]})
+
+
+def test_compact_size():
+    print('Testing the size of pynauty.CompactGraph')
+    n = 100
+    adjacency_dict = {i: [(i + 1) % n, (i + 7) % n] for i in range(n)}
+    c = CompactGraph(n, adjacency_dict=adjacency_dict)
+    assert sys.getsizeof(c) < 12 * (n + 2 * n) + 100
+    flat = array.array('i', [v for x, ys in adjacency_dict.items()
+                             for y in ys for v in (x, y)])
+    e = CompactGraph.from_edge_array(
+        n, memoryview(flat).cast('B').cast('i', (2 * n, 2)))
+    assert e.adjacency_dict == c.adjacency_dict
+
+
+def test_compact_new():
+    print('Testing pynauty.CompactGraph made by __new__ alone')
+    c = CompactGraph.__new__(CompactGraph)
+    assert c.number_of_vertices == 0 and c.adjacency_dict == {}
+    assert c.copy().number_of_vertices == 0
+    assert sys.getsizeof(c) > 0
+    assert autgrp(c)[1] == 1
+    assert certificate(c) == certificate(Graph(0))
+    assert pickle.loads(pickle.dumps(c)).number_of_vertices == 0
+    c.__init__(3, adjacency_dict={0: [1]})
+    assert autgrp(c)[1] == 2
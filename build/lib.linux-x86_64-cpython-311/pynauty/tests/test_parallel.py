@@ -0,0 +1,118 @@
+#!/usr/bin/env python
+
+import importlib
+import multiprocessing
+import random
+import struct
+import threading
+from pynauty import (Graph, CompactGraph, autgrp, certificate, canon_label,
+                     parallel_map)
+import pytest
+
+
+def random_graphs(seed, count):
+    rng = random.Random(seed)
+    graphs = []
+    for i in range(count):
+        n = rng.randrange(0, 40)
+        adj = {v: [w for w in range(n) if rng.random() < 0.2]
+               for v in range(n)}
+        coloring = [set(range(0, n, 3))] if i % 3 == 0 else []
+        cls = CompactGraph if i % 4 == 0 else Graph
+        graphs.append(cls(n, i % 5 == 0, adj, coloring))
+    return graphs
+
+
+@pytest.mark.parametrize('processes', [1, 3])
+def test_parallel_map(processes):
+    print('Testing pynauty.parallel_map with %d processes' % processes)
+    graphs = random_graphs(11, 50)
+    assert (parallel_map(certificate, graphs, processes) ==
+            [certificate(g) for g in graphs])
+    assert (parallel_map('canon_label', graphs, processes) ==
+            [canon_label(g) for g in graphs])
+    assert (parallel_map('orbits', graphs, processes) ==
+            [autgrp(g)[3] for g in graphs])
+
+
+def test_parallel_map_errors():
+    print('Testing pynauty.parallel_map errors')
+    assert parallel_map(certificate, []) == []
+    with pytest.raises(ValueError):
+        parallel_map(autgrp, [Graph(3)])
+    with pytest.raises(TypeError):
+        parallel_map(certificate, [None])
+
+    # only pynauty's own functions, not others of the same name
+    def certificate_(g):
+        return b''
+    certificate_.__name__ = 'certificate'
+    with pytest.raises(ValueError):
+        parallel_map(certificate_, [Graph(3)])
+
+
+@pytest.mark.parametrize('threads', [False, True])
+def test_parallel_map_concurrent(threads, monkeypatch):
+    print('Testing concurrent pynauty.parallel_map calls, threads=%s' %
+          threads)
+    if threads:
+        # the pool of threads used where processes cannot be forked
+        monkeypatch.setattr(multiprocessing, 'get_all_start_methods',
+                            lambda: ['spawn'])
+    batches = [random_graphs(20 + i, 30 + 7 * i) for i in range(4)]
+    expected = [[certificate(g) for g in graphs] for graphs in batches]
+    results = [None] * len(batches)
+
+    def work(i):
+        for _ in range(5):
+            r = parallel_map(certificate, batches[i], 1 + i % 2 * 2)
+            if r != expected[i]:
+                break
+        results[i] = r
+    workers = [threading.Thread(target=work, args=(i,))
+               for i in range(len(batches))]
+    for w in workers:
+        w.start()
+    for w in workers:
+        w.join()
+    assert results == expected
+
+
+def test_run_packed_checks():
+    print('Testing that run_packed() checks its buffers')
+    nautywrap = importlib.import_module('pynauty.nautywrap')
+    graphs = [Graph(5, adjacency_dict={v: [(v + 1) % 5] for v in range(5)}),
+              Graph(6, adjacency_dict={0: [1, 2]}, vertex_coloring=[{0}])]
+    for kind in range(3):
+        packed, offsets = nautywrap.pack_graphs(graphs, kind)
+        out = bytearray(offsets[-1])
+        nautywrap.run_packed(packed, 0, 2, out)
+        # the header is 3 + 2 * 3 size_t words, the records follow
+        graph_at = struct.unpack_from('3N', packed, 24)
+        heads_at = graph_at[0] + 4 * (3 + 6)
+
+        def size_t(word, value):
+            b = bytearray(packed)
+            struct.pack_into('N', b, 8 * word, value)
+            return bytes(b)
+
+        def int_at(at, value):
+            b = bytearray(packed)
+            struct.pack_into('i', b, at, value)
+            return bytes(b)
+        bad = [packed[:len(packed) - 8], packed[:40],
+               size_t(0, 2**40), size_t(1, 0), size_t(2, 7),
+               size_t(3, len(packed) - 4), size_t(3, graph_at[0] + 2),
+               size_t(7, 2**62), size_t(7, 4),
+               int_at(graph_at[0], 4), int_at(graph_at[0], -1),
+               int_at(graph_at[0] + 4, 2),
+               int_at(graph_at[0] + 4 * 4, 9),
+               int_at(heads_at, 10**6), int_at(heads_at, -1),
+               int_at(graph_at[1] + 4 * (3 + 7 + 2), 5)]
+        for b in bad:
+            with pytest.raises(ValueError):
+                nautywrap.run_packed(b, 0, 2, out)
+        with pytest.raises(IndexError):
+            nautywrap.run_packed(packed, 0, 3, out)
+        with pytest.raises(ValueError):
+            nautywrap.run_packed(packed, 0, 2, bytearray(offsets[-1] - 1))
@@ -0,0 +1,41 @@
+#!/usr/bin/env python
+
+import random
+from concurrent.futures import ThreadPoolExecutor
+from pynauty import Graph, autgrp, certificate, certificates, canon_label, Version
+import pytest
+
+
+def random_graph(n, p, seed):
+    rng = random.Random(seed)
+    adjacency_dict = {}
+    for x in range(n):
+        for y in range(x + 1, n):
+            if rng.random() < p:
+                adjacency_dict.setdefault(x, []).append(y)
+    return Graph(n, adjacency_dict=adjacency_dict)
+
+
+def test_threads():
+    print(Version())
+    print('Testing pynauty.{autgrp(),certificate(),canon_label()} in threads')
+    graphs = [random_graph(n, 0.3, seed) for seed, n in
+              enumerate([5, 17, 33, 64, 65, 100] * 4)]
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        autgrps = list(pool.map(autgrp, graphs))
+        certs = list(pool.map(certificate, graphs))
+        labels = list(pool.map(canon_label, graphs))
+    assert autgrps == [autgrp(g) for g in graphs]
+    assert certs == [certificate(g) for g in graphs]
+    assert labels == [canon_label(g) for g in graphs]
+
+
+def test_certificates():
+    graphs = [random_graph(n, 0.2, seed) for seed, n in
+              enumerate([1, 5, 17, 33, 64, 65, 100, 130] * 3)]
+    graphs[3].set_vertex_coloring([set([0, 1]), set([5])])
+    expected = [certificate(g) for g in graphs]
+    assert certificates(graphs) == expected
+    assert certificates(iter(graphs), threads=4) == expected
+    assert certificates(graphs, threads=None) == expected
+    assert certificates([]) == []
@@ -57,12 +57,18 @@ data_files = []
 ext_pynauty = Extension(
         name = MODULE + '.nautywrap',
         sources = [ pynauty_dir + '/' + 'nautywrap.c', ],
-        extra_compile_args = [ '-O4', '-fPIC' ],
+        extra_compile_args = [ '-O4', '-fPIC', '-pthread' ],
+        extra_link_args = [ '-pthread' ],
         extra_objects = [ nauty_dir + '/' + 'nauty.o',
                           nauty_dir + '/' + 'nautil.o',
                           nauty_dir + '/' + 'naugraph.o',
                           nauty_dir + '/' + 'schreier.o',
                           nauty_dir + '/' + 'naurng.o',
+                          nauty_dir + '/' + 'nausparse.o',
+                          nauty_dir + '/' + 'traces.o',
+                          nauty_dir + '/' + 'gtools.o',
+                          nauty_dir + '/' + 'naututil.o',
+                          nauty_dir + '/' + 'nautinv.o',
                         ],
         include_dirs = [ nauty_dir, pynauty_dir ]
     )
@@ -9,14 +9,23 @@ Classes:
 
     Graph   - An adjacency dictionary based graph object.
         Graph can represent vertex colored, directed or undirected graphs.
+    CompactGraph - A Graph stored in contiguous C arrays.
+    Handle  - A graph kept in Nauty's form, edited edge by edge.
+    CertCache - A cache of certificates and canonical labelings.
 
 Functions:
 
     autgrp      - Compute the automorphism group of a graph.
+    analyze     - Compute several results of a single search.
     isomorphic  - Compare two graphs for isomorphism.
+    isomorphism - Find an isomorphism between two graphs.
     certificate - Compute a "certificate" based on the canonical labeling
                   of the graph's vertices.
+    certificates - Compute the certificates of many graphs at once.
+    parallel_map - Compute results of many graphs with worker processes.
     canon_label - Computes the canonical relabelling of a graph.
+    select_mode - The search engine mode='auto' uses for a graph.
+    clear_cache - Free the memory kept for reuse between calls.
 '''
 
 __LICENSE__     = '''
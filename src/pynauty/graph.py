@@ -19,28 +19,48 @@ GNU General Public License for more details.
 
 __all__ = [
     'Graph',
+    'CompactGraph',
+    'Handle',
+    'CertCache',
     'autgrp',
+    'analyze',
     'isomorphic',
+    'isomorphism',
     'certificate',
+    'certificates',
+    'parallel_map',
     'canon_label',
     'canon_graph',
     'delete_random_edge',
+    'select_mode',
+    'clear_cache',
 ]
 
 from . import nautywrap
+import array
+import collections
 import copy
+import functools
+import mmap
+import multiprocessing.pool
+import os
 import random
+import struct
+import threading
+import zlib
 
 
 class Graph(object):
     '''
     Graph instantiates an adjacency dictionary based graph object.
-    It can represent vertex colored, directed or undirected graphs.
+    It can represent vertex or edge colored, directed or undirected
+    graphs, and multigraphs through edge colors.
     '''
 
     def __init__(self, number_of_vertices, directed=False,
                  adjacency_dict={},
-                 vertex_coloring=[]):
+                 vertex_coloring=[],
+                 edge_colors={}):
         '''
         *number_of_vertices*
             The number of vertices of the graph; the vertices are
@@ -59,11 +79,16 @@ class Graph(object):
             partition of the vertex set; vertices not listed are
             placed into a single additional part.  Optional, default
             is no coloring.
+
+        *edge_colors*
+            key: an edge (x, y), value: its color, a positive int.
+            Optional, default is no edge colors, see set_edge_colors().
         '''
         self.number_of_vertices = number_of_vertices
         self.directed = directed
         self.set_adjacency_dict(adjacency_dict)
         self.set_vertex_coloring(vertex_coloring)
+        self.set_edge_colors(edge_colors)
 
     def _check_vertices(self, vs):
         for v in vs:
@@ -72,7 +97,46 @@ class Graph(object):
                     'vertex %d conflicts with number_of_vertices=%d' %
                     (v, self.number_of_vertices))
 
+    @classmethod
+    def from_edge_array(cls, number_of_vertices, edges, directed=False,
+                        vertex_coloring=[]):
+        '''
+        Make a Graph from arrays of 32 or 64 bit integers, like NumPy
+        arrays or any other objects supporting the buffer protocol.
+        Nauty's data structures are filled straight from the arrays,
+        without converting the vertices to Python objects.
+
+        *number_of_vertices*
+            The number of vertices of the graph.
+
+        *edges*
+            Either an array of shape (E, 2) holding an edge, or the
+            (tail, head) of an arc, in each row, or a pair of arrays
+            (indptr, indices) in compressed sparse row format: the
+            neighbors of vertex v are indices[indptr[v]:indptr[v+1]].
+
+        *directed*, *vertex_coloring*
+            As for the constructor.  Edge colors can be added with
+            set_edge_colors().
+
+        The arrays are referenced, not copied, until adjacency_dict is
+        first used: then it is built from them and they are dropped.
+        Until then, changing the arrays changes the Graph too, and
+        results computed or cached for it no longer match. copy() and
+        pickling take copies of the arrays, so the copies keep the
+        edges at the time they were made.
+        '''
+        nautywrap.check_edge_array(number_of_vertices, edges)
+        g = cls(number_of_vertices, directed=directed,
+                vertex_coloring=vertex_coloring)
+        g._edge_array = edges
+        g._adjacency_dict = None
+        return g
+
     def _get_adjacency_dict(self):
+        if self._edge_array is not None:
+            self._adjacency_dict = _edge_array_dict(self._edge_array)
+            self._edge_array = None
         return self._adjacency_dict
 
     adjacency_dict = property(_get_adjacency_dict)
@@ -83,14 +147,15 @@ class Graph(object):
 
         *adjacency_dict*
             key: a vertex, value: a list of vertices linked to the
-            key vertex. Duplicate vertices will be removed, since there is no
-            multigraph support.
+            key vertex. Duplicate vertices will be removed; give
+            multiple edges as edge colors, see set_edge_colors().
         '''
         for v, vs in adjacency_dict.items():
             self._check_vertices([v])
             self._check_vertices(vs)
         self._adjacency_dict = dict([(k,list(set(vs)))
                                      for k,vs in adjacency_dict.items()])
+        self._edge_array = None
 
     def connect_vertex(self, v, neighbors):
         '''
@@ -102,11 +167,12 @@ class Graph(object):
         *neighbors*
             A vertex or a list of vertices to which *v* should be connected.
             The *heads* of the arcs if the Graph is directed. Duplciate
-            vertices are removed, since there is no multigraph support.
+            vertices are removed; give multiple edges as edge colors,
+            see set_edge_colors().
 
         '''
         self._check_vertices([v])
-        self._adjacency_dict.setdefault(v, [])
+        self.adjacency_dict.setdefault(v, [])
         if isinstance(neighbors, list):
             self._check_vertices(neighbors)
             self._adjacency_dict[v].extend(neighbors)
@@ -116,6 +182,9 @@ class Graph(object):
         self._adjacency_dict[v] = list(set(self._adjacency_dict[v]))
 
     def _get_vertex_coloring(self):
+        if self._color_array is not None:
+            self._vertex_coloring = _color_array_coloring(self._color_array)
+            self._color_array = None
         return self._vertex_coloring
 
     vertex_coloring = property(_get_vertex_coloring)
@@ -128,7 +197,24 @@ class Graph(object):
             A list of disjoint sets of vertices representing a
             partition of the vertex set; vertices not listed are
             placed into a single additional part.
+
+            Or an array of integers from 0 to 2**31 - 1, the color of each
+            vertex, like a NumPy array, bytes or any other object
+            supporting the buffer protocol.  The parts are the color
+            classes in increasing order of colors.  Nauty's partition
+            is sorted from the array, which is referenced until
+            *vertex_coloring* is first used.
         '''
+        self._color_array = None
+        try:
+            memoryview(vertex_coloring)
+        except TypeError:
+            pass
+        else:
+            nautywrap.check_colors(self.number_of_vertices, vertex_coloring)
+            self._color_array = vertex_coloring
+            self._vertex_coloring = None
+            return
         self._vertex_coloring = []
         if vertex_coloring:
             vs = set(range(self.number_of_vertices))
@@ -143,94 +229,814 @@ class Graph(object):
             if len(self._vertex_coloring) == 1:
                 self._vertex_coloring = []
 
+    def _get_edge_colors(self):
+        return self._edge_colors
+
+    edge_colors = property(_get_edge_colors)
+
+    def set_edge_colors(self, edge_colors):
+        '''
+        Color the edges of the Graph, like the bond orders of a
+        molecule or the multiplicities of the edges of a multigraph.
+
+        *edge_colors*
+            key: an edge (x, y), the arc from x to y if the Graph is
+            directed, value: its color, a positive int.  Edges not
+            listed have color 1; the listed ones are edges even if
+            adjacency_dict misses them.
+
+        The searches work on a layered graph, as in the nauty guide:
+        colors up to c take c.bit_length() copies of the vertices, so
+        small colors are cheaper. Results, like generators, orbits or
+        canonical labelings, are on the vertices of the Graph.
+        Handle, certificates() and parallel_map() do not support edge
+        colors.
+        '''
+        colors = {}
+        for (x, y), c in edge_colors.items():
+            self._check_vertices([x, y])
+            if not isinstance(c, int) or c < 1:
+                raise ValueError('edge (%d, %d) has color %r, not a '
+                                 'positive int' % (x, y, c))
+            colors[x, y] = c
+        self._edge_colors = colors
+
     def copy(self):
         '''
         Make a copy of the Graph.
         '''
         return copy.deepcopy(self)
 
+    def __getstate__(self):
+        # the arrays given by the caller, which may be memoryviews or
+        # change later, are copied into arrays of our own
+        state = self.__dict__.copy()
+        if self._edge_array is not None:
+            state['_edge_array'] = _edge_array_copy(
+                self.number_of_vertices, self._edge_array)
+        if self._color_array is not None:
+            state['_color_array'] = array.array(
+                'q', memoryview(self._color_array).tolist())
+        return state
+
     def __repr__(self):
-        s = ['Graph(number_of_vertices=%d, directed=%s,' %
-             (self.number_of_vertices, self.directed)]
+        s = ['%s(number_of_vertices=%d, directed=%s,' %
+             (type(self).__name__, self.number_of_vertices, self.directed)]
         s.append(' adjacency_dict = {')
-        for k, v in self._adjacency_dict.items():
+        for k, v in self.adjacency_dict.items():
             v.sort()
             s.append('  %d: %s,' % (k, v))
         s.append(' },')
         s.append(' vertex_coloring = [')
-        for x in self._vertex_coloring:
+        for x in self.vertex_coloring:
             s.append('  set(%s),' % list(x))
         s.append(' ],')
+        if getattr(self, '_edge_colors', None):
+            s.append(' edge_colors = {')
+            for e, c in sorted(self._edge_colors.items()):
+                s.append('  %s: %d,' % (e, c))
+            s.append(' },')
         s.append(')')
         return '\n'.join(s)
 
 
-def autgrp(g):
+class CompactGraph(nautywrap.CompactGraph):
+    '''
+    CompactGraph is a Graph stored in contiguous memory: the sorted
+    adjacency lists in compressed sparse row form and a color per
+    vertex. It takes about 4 bytes per edge and per vertex, and it is
+    handed to Nauty without any conversion of Python objects.
+
+    It has the same constructor and methods as Graph, except that
+    *adjacency_dict* and *vertex_coloring* are new objects built on
+    each access: change the graph with set_adjacency_dict(),
+    connect_vertex() and set_vertex_coloring(). copy() duplicates the
+    arrays.
+    '''
+    __slots__ = ()
+
+    @classmethod
+    def from_edge_array(cls, number_of_vertices, edges, directed=False,
+                        vertex_coloring=[]):
+        '''
+        Make a CompactGraph from edge arrays, see Graph.from_edge_array().
+        The arrays are copied into the CompactGraph.
+        '''
+        g = cls(number_of_vertices, directed, {}, vertex_coloring)
+        g._set_edge_array(edges)
+        return g
+
+    __repr__ = Graph.__repr__
+
+
+_graph_types = (Graph, CompactGraph)
+
+
+class Handle(nautywrap.Handle):
+    '''
+    Handle(g) keeps the Nauty graph made of *g* for repeated searches
+    while single edges are added or removed, as in local search over
+    graphs. Each edit is one bit flip in the adjacency matrix; the
+    graph is not converted again.
+
+    *g*
+        A Graph or CompactGraph object, it is copied: later changes
+        to *g* do not affect the handle and vice versa.
+
+    The vertex coloring of *g* is kept, edge colors are not
+    supported. The handle uses the 'dense' mode. Its methods are
+
+    add_edge(i, j), remove_edge(i, j), has_edge(i, j)
+        Edit or query the edge i -> j (and j -> i if undirected).
+
+    autgrp(), certificate(format='raw'), canon_label()
+        The same as the module level functions applied to the graph
+        as currently edited.
+
+    release()
+        Free the Nauty graph now instead of when the handle is
+        garbage collected; using the handle after raises ValueError.
+    '''
+    __slots__ = ()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.release()
+
+    def __repr__(self):
+        return '<%s of %d vertices>' % (type(self).__name__,
+                                        self.number_of_vertices)
+
+
+class CertCache(object):
+    '''
+    CertCache keeps the results of certificate() and canon_label() for
+    graphs seen before; pass it as their *cache* argument. A graph is
+    looked up by a hash of its adjacency lists and coloring, built
+    from Nauty's hashgraph(), then compared exactly, so a hit returns
+    what the search would. The key depends on the labeling: a
+    relabeled copy of a graph is a miss.
+
+    *capacity*
+        The maximum number of results kept; the least recently used
+        one is dropped to make room. Optional, default is 1024.
+
+    *shared*
+        Keep the results in an anonymous shared memory map instead of
+        a dictionary, so that the processes forked after the cache was
+        made, like multiprocessing workers on Unix, share them. A
+        shared cache replaces the least recently used of 4 slots a
+        graph may go to, and it skips graphs whose key and result do
+        not fit in *slot_size* bytes. Optional, default is False.
+
+    *slot_size*
+        The bytes of each slot of a shared cache. A graph takes 4
+        bytes per vertex and per adjacency list entry, twice the
+        number of edges if undirected, plus the result. Optional,
+        default is 4096.
+
+    The hits and misses attributes count the lookups, summed over
+    all processes if shared, to tune *capacity*; clear() empties the
+    cache and resets them.
+    '''
+    _header = struct.Struct('<8sqqqqq')
+    _slot = struct.Struct('<QqII')
+    _magic = b'pynauty1'
+    _ways = 4
+
+    def __init__(self, capacity=1024, shared=False, slot_size=4096):
+        if capacity < 1:
+            raise ValueError('capacity must be positive')
+        self.shared = bool(shared)
+        if self.shared:
+            if slot_size <= self._slot.size:
+                raise ValueError('slot_size must be more than %d' %
+                                 self._slot.size)
+            self._no_buckets = -(-capacity // self._ways)
+            self.capacity = self._no_buckets * self._ways
+            self.slot_size = slot_size
+            self._map = mmap.mmap(-1, 64 + self.capacity * slot_size)
+            self._lock = multiprocessing.Lock()
+        else:
+            self.capacity = capacity
+            self._table = collections.OrderedDict()
+            self._lock = threading.Lock()
+        self.clear()
+
+    def clear(self):
+        '''
+        Drop all results and reset the counters.
+        '''
+        with self._lock:
+            if self.shared:
+                self._map[:] = bytes(len(self._map))
+                self._header.pack_into(self._map, 0, self._magic,
+                                       self.capacity, self.slot_size,
+                                       0, 0, 0)
+            else:
+                self._table.clear()
+                self._hits = self._misses = 0
+
+    def _counters(self):
+        # the clock, hits and misses of a shared cache
+        return self._header.unpack_from(self._map, 0)[3:]
+
+    @property
+    def hits(self):
+        if self.shared:
+            return self._counters()[1]
+        return self._hits
+
+    @property
+    def misses(self):
+        if self.shared:
+            return self._counters()[2]
+        return self._misses
+
+    def __len__(self):
+        if not self.shared:
+            return len(self._table)
+        with self._lock:
+            return sum(1 for i in range(self.capacity)
+                       if self._slot.unpack_from(
+                           self._map, 64 + i * self.slot_size)[1] != 0)
+
+    def __repr__(self):
+        return '<%s of %d/%d results, %d hits, %d misses>' % (
+            type(self).__name__, len(self), self.capacity,
+            self.hits, self.misses)
+
+    def _count(self, hit):
+        # count a lookup and return the clock of a shared cache
+        if not self.shared:
+            if hit:
+                self._hits += 1
+            else:
+                self._misses += 1
+            return 0
+        clock, hits, misses = self._counters()
+        clock += 1
+        self._header.pack_into(self._map, 0, self._magic, self.capacity,
+                               self.slot_size, clock,
+                               hits + hit, misses + (not hit))
+        return clock
+
+    def _get(self, key, h):
+        # the result stored for key with hash h, None if there is none
+        with self._lock:
+            if not self.shared:
+                value = self._table.get(key)
+                if value is not None:
+                    self._table.move_to_end(key)
+                self._count(value is not None)
+                return value
+            for offset in self._bucket(h):
+                slot_h, stamp, key_len, value_len = self._slot.unpack_from(
+                    self._map, offset)
+                start = offset + self._slot.size
+                if (stamp != 0 and slot_h == h and key_len == len(key) and
+                        self._map[start:start + key_len] == key):
+                    self._slot.pack_into(self._map, offset, h,
+                                         self._count(True),
+                                         key_len, value_len)
+                    start += key_len
+                    return self._map[start:start + value_len]
+            self._count(False)
+            return None
+
+    def _put(self, key, h, value):
+        # store value for key with hash h
+        with self._lock:
+            if not self.shared:
+                self._table[key] = value
+                self._table.move_to_end(key)
+                while len(self._table) > self.capacity:
+                    self._table.popitem(last=False)
+                return
+            if self._slot.size + len(key) + len(value) > self.slot_size:
+                return
+            oldest = None
+            for offset in self._bucket(h):
+                slot_h, stamp, key_len, _ = self._slot.unpack_from(
+                    self._map, offset)
+                start = offset + self._slot.size
+                if (stamp != 0 and slot_h == h and key_len == len(key) and
+                        self._map[start:start + key_len] == key):
+                    return
+                if oldest is None or stamp < oldest[1]:
+                    oldest = (offset, stamp)
+            offset = oldest[0]
+            clock = self._counters()[0]
+            self._slot.pack_into(self._map, offset, h, clock + 1,
+                                 len(key), len(value))
+            start = offset + self._slot.size
+            self._map[start:start + len(key) + len(value)] = key + value
+
+    def _bucket(self, h):
+        # the offsets of the slots of the bucket of hash h
+        first = 64 + (h % self._no_buckets) * self._ways * self.slot_size
+        return range(first, first + self._ways * self.slot_size,
+                     self.slot_size)
+
+
+def _cached(cache, g, tag, compute):
+    # compute() for graph g, or the result cache has for it under tag
+    key, h = nautywrap.graph_key(g)
+    tag = tag.encode()
+    key = tag + key
+    h ^= zlib.crc32(tag)
+    value = cache._get(key, h)
+    if value is None:
+        value = compute()
+        cache._put(key, h, value)
+    return value
+
+
+def _edge_array_dict(edges):
+    # the adjacency dictionary of the arrays given to from_edge_array()
+    adjacency = {}
+    if isinstance(edges, tuple):
+        indptr, indices = (memoryview(a).tolist() for a in edges)
+        for x in range(len(indptr) - 1):
+            if indptr[x] < indptr[x + 1]:
+                adjacency[x] = indices[indptr[x]:indptr[x + 1]]
+    else:
+        for x, y in memoryview(edges).tolist():
+            adjacency.setdefault(x, []).append(y)
+    return dict((x, list(set(ys))) for x, ys in adjacency.items())
+
+
+def _edge_array_copy(n, edges):
+    # the arrays given to from_edge_array() as (indptr, indices)
+    # arrays owned by the Graph
+    if isinstance(edges, tuple):
+        indptr, indices = (memoryview(a).tolist() for a in edges)
+    else:
+        rows = [[] for x in range(n)]
+        for x, y in memoryview(edges).tolist():
+            rows[x].append(y)
+        indptr = [0]
+        for ys in rows:
+            indptr.append(indptr[-1] + len(ys))
+        indices = [y for ys in rows for y in ys]
+    return array.array('q', indptr), array.array('q', indices)
+
+
+def _color_array_coloring(colors):
+    # the vertex coloring of an array given to set_vertex_coloring()
+    parts = {}
+    for v, c in enumerate(memoryview(colors).tolist()):
+        parts.setdefault(c, set()).add(v)
+    if len(parts) < 2:
+        return []
+    return [parts[c] for c in sorted(parts)]
+
+
+def autgrp(g, mode='dense', as_array=False, on_generator=None,
+           timeout=None, max_nodes=None, invariant=None, invararg=0,
+           mininvarlevel=0, maxinvarlevel=1, schreier=False,
+           schreier_fails=None, tc_level=None, refine=None):
     '''
     Compute the automorphism group of a graph.
 
     *g*
         A Graph object.
 
+    *mode*
+        The search engine: 'dense' runs nauty on the adjacency
+        matrix, 'sparse' runs nauty on a sparse representation and
+        'traces' runs Traces (undirected graphs only) and 'auto'
+        picks one of them for the graph, see select_mode(). The sparse
+        modes need memory proportional to the number of edges rather
+        than to the square of the number of vertices. Optional,
+        default is 'dense'.
+
+    *as_array*
+        Return the generators as a 2-dimensional array of C ints, one
+        generator per row, and the orbits as a 1-dimensional one,
+        instead of lists of Python ints. The arrays support the buffer
+        protocol: read them with memoryview() or numpy.asarray().
+        Optional, default is False.
+
+    *on_generator*
+        Receive the generators one by one as Nauty finds them instead
+        of collecting them all, for groups with too many generators
+        to hold. Either a function, called with each generator as a
+        list, or a writable array of C ints, like a NumPy int32 array,
+        whose rows of number_of_vertices ints are filled with the
+        generators in turn, starting over at the first row when all
+        are used. If the function raises an exception, the search
+        stops and autgrp() raises the exception. Optional, default is
+        None.
+
+    *timeout*
+        Stop the search with TimeoutError after that many seconds.
+        Optional, default is no limit.
+
+    *max_nodes*
+        Stop the search with TimeoutError after that many nodes of
+        the search tree. Traces does not count its nodes: with
+        mode='traces', or 'auto' picking Traces, it raises ValueError.
+        Optional, default is no limit.
+
+    Nauty has a single flag to stop a search for the whole process:
+    when *timeout* or *max_nodes* stops one search, every search
+    running in other threads at that moment, like those of
+    certificates() or of a Handle, stops too and starts over from
+    scratch, losing its progress. Under a steady stream of searches
+    cut short, a long search may thus take much longer than alone.
+    A search with *on_generator* that has already passed on some
+    generators does not start over but raises RuntimeError.
+
+    *invariant*
+        The name of a vertex invariant of Nauty's nautinv.c that
+        splits the cells refinement leaves alone, which can shorten
+        the search on regular graphs and designs by orders of
+        magnitude: 'twopaths', 'adjtriang', 'triples', 'quadruples',
+        'celltrips', 'cellquads', 'cellquins', 'distances', 'indsets',
+        'cliques', 'cellcliq', 'cellind', 'adjacencies', 'cellfano',
+        'cellfano2' or 'refinvar'. mode='sparse' has only 'distances'
+        and 'adjacencies', and Traces has none: with mode='traces', or
+        'auto' picking Traces, it raises ValueError. Optional, default
+        is None.
+
+    *invararg*, *mininvarlevel*, *maxinvarlevel*
+        The argument of the invariant, see Nauty's documentation,
+        and the levels of the search tree it is applied at, the root
+        being level 1; a negative level means up to that level until
+        the invariant splits a cell. Optional, defaults are 0, 0 and
+        1, Nauty's own.
+
+    *schreier*
+        Let nauty prune the search tree with the random Schreier-Sims
+        method of schreier.c, which finds more of the automorphism
+        group early and pays off on graphs with large groups. The
+        results are the same, except that the generators found may
+        differ. Traces always prunes this way. Optional, default is
+        False.
+
+    *schreier_fails*
+        With *schreier*, the number of random tests that must fail in
+        a row before the group found so far is taken as complete:
+        more makes the pruning thorough but slower. Optional, default
+        is None, Nauty's 10.
+
+    *tc_level*
+        The deepest level of the search tree at which nauty chooses
+        the target cell with bestcell(), trying the cells that split
+        the others most, rather than taking the first large one. The
+        choice shapes the search tree: tune it per graph family.
+        Ignored for directed graphs. Optional, default is None,
+        Nauty's 100.
+
+    *refine*
+        The partition refinement procedure: 'refine', nauty's default,
+        'refine1', its faster version for graphs of at most 64 (or
+        32) vertices in mode 'dense', or a PyCapsule named
+        "pynauty.userrefproc" holding a C function with the signature
+        of nauty's refine(), which is set as options.userrefproc. In
+        mode 'sparse' the function gets a sparsegraph as its graph.
+        Optional, default is None, the default of the mode.
+
+    *tc_level* and *refine* do not apply to Traces: with
+    mode='traces', or 'auto' picking Traces, they raise ValueError.
+
+    A search can also be interrupted with Ctrl-C, as nauty runs the
+    Python signal handlers now and then; not so with Traces.
+
     return -> (generators, grpsize1, grpsize2, orbits, numorbits)
         For the detailed description of the returned components, see
-        Nauty's documentation.
+        Nauty's documentation. With *on_generator*, *generators* is
+        the number of generators found.
+    '''
+    if not isinstance(g, _graph_types):
+        raise TypeError
+    return nautywrap.graph_autgrp(g, mode, bool(as_array), on_generator,
+                                  timeout or 0, max_nodes or 0, invariant,
+                                  invararg, mininvarlevel, maxinvarlevel,
+                                  bool(schreier), schreier_fails or 0,
+                                  -1 if tc_level is None else tc_level,
+                                  refine)
+
+
+def analyze(g, want=('gens', 'orbits', 'canon', 'cert', 'stats', 'order'),
+            mode='dense', format='raw'):
+    '''
+    Compute several results of a single Nauty search.
+
+    *g*
+        A Graph object.
+
+    *want*
+        The names of the results to compute: 'gens' for the generators
+        of the automorphism group, 'orbits' for its orbits, 'canon'
+        for the canonical labeling as in canon_label(), 'cert' for the
+        certificate as in certificate(), 'stats' for the statistics
+        of the search and 'order' for the exact order of the group.
+        Leaving out 'canon' and 'cert' saves the canonical labeling.
+        Optional, default is all of them.
+
+    *mode*
+        The search engine, see autgrp(). Optional, default is 'dense'.
+
+    *format*
+        The format of the certificate, see certificate(). Optional,
+        default is 'raw'.
+
+    return ->
+        A dictionary keyed by the names in *want*. 'stats' is a
+        named tuple of the fields of Nauty's statsblk, like grpsize1,
+        grpsize2, numorbits, numnodes, numbadleaves, maxlevel and
+        tctotal, followed by the search engine that ran as *mode*, and
+        the wall clock and CPU seconds of the search as *time* and
+        *cpu_time*. A large numnodes points at a large search tree,
+        a large time per node at costly refinement. 'order' is an int,
+        the product of the orbit sizes along the first path of the
+        search tree, where grpsize1 * 10**grpsize2 is only exact within
+        rounding error. Traces does not report these orbit sizes: when
+        the search runs Traces, 'order' is None if the order is 10**10
+        or more.
     '''
-    if not isinstance(g, Graph):
+    if not isinstance(g, _graph_types):
         raise TypeError
-    return nautywrap.graph_autgrp(g)
+    if isinstance(want, str):
+        want = (want,)
+    return nautywrap.graph_analyze(g, tuple(want), mode, format)
 
 
-def certificate(g):
+def certificate(g, mode='dense', format='raw', timeout=None,
+                max_nodes=None, cache=None, invariant=None, invararg=0,
+                mininvarlevel=0, maxinvarlevel=1, schreier=False,
+                schreier_fails=None, tc_level=None, refine=None):
     '''
     Compute a certificate based on the canonical labeling of vertices.
 
     *g*
         A Graph object.
 
+    *mode*
+        The search engine, see autgrp(). Certificates computed in
+        different modes are not comparable. Optional, default is
+        'dense'.
+
+    *format*
+        The encoding of the canonical graph. 'raw' is nauty's own
+        representation: the adjacency matrix in 'dense' mode, whose
+        size grows with the square of the number of vertices, and the
+        degrees and neighbour lists otherwise. 'edges' is the sorted
+        list of canonical edges as pairs of native ints, (i, j) with
+        i <= j only for undirected graphs. 'sparse6' is the sparse6
+        string of the canonical graph, or its digraph6 string if the
+        graph is directed. 'hash128' and 'hash256' are 16 and 32 byte
+        hashes built from Nauty's hashgraph(); unlike the other
+        formats they can collide for non-isomorphic graphs. Optional,
+        default is 'raw'.
+
+    *timeout*, *max_nodes*
+        The budget of the search, see autgrp(). Optional, default is
+        no limit.
+
+    *cache*
+        A CertCache to look the graph up in first, and to store the
+        certificate in. Optional, default is None.
+
+    *invariant*, *invararg*, *mininvarlevel*, *maxinvarlevel*
+        The vertex invariant the search applies, see autgrp(). The
+        invariant takes part in the canonical labeling: certificates
+        computed with different invariants or options are not
+        comparable. Optional, default is none.
+
+    *schreier*, *schreier_fails*
+        Prune the search with the Schreier-Sims method, see autgrp().
+        The certificate does not depend on it. Optional, default is
+        False.
+
+    *tc_level*, *refine*
+        The target cell level and refinement procedure of nauty, see
+        autgrp(). They take part in the canonical labeling like the
+        invariant. Optional, default is Nauty's.
+
     return ->
         The certificate as a byte string.
     '''
-    if not isinstance(g, Graph):
+    if not isinstance(g, _graph_types):
         raise TypeError
-    return nautywrap.graph_cert(g)
+    search_options = (invariant, invararg, mininvarlevel, maxinvarlevel,
+                      bool(schreier), schreier_fails or 0,
+                      -1 if tc_level is None else tc_level, refine)
+    if cache is not None:
+        # the pruning does not change the certificate
+        key_options = search_options[:4] + search_options[6:]
+        return _cached(cache, g, 'cert:%s:%s:%r:' % (mode, format,
+                                                     key_options),
+                       lambda: nautywrap.graph_cert(g, mode, format,
+                                                    timeout or 0,
+                                                    max_nodes or 0,
+                                                    *search_options))
+    return nautywrap.graph_cert(g, mode, format, timeout or 0,
+                                max_nodes or 0, *search_options)
+
+
+def certificates(graphs, threads=1, format='raw'):
+    '''
+    Compute the certificates of many graphs in a single call.
+
+    *graphs*
+        An iterable of Graph objects.
+
+    *threads*
+        The number of threads computing certificates in parallel.
+        Optional, default is 1. If None, the number of CPUs is used.
+
+    *format*
+        The encoding of the certificates, see certificate().
+        Optional, default is 'raw'.
+
+    return ->
+        The list of certificates as byte strings, in the order of
+        *graphs*. Each one is the same as returned by certificate().
+        Graphs with edge colors are not supported.
+    '''
+    graphs = list(graphs)
+    for g in graphs:
+        if not isinstance(g, _graph_types):
+            raise TypeError
+    if threads is None:
+        threads = os.cpu_count() or 1
+    return nautywrap.graph_certs(graphs, threads, format)
+
+
+_packed_kinds = {'certificate': 0, 'canon_label': 1, 'orbits': 2}
+
+# the batch of parallel_map() in a worker process, set by _init_worker()
+_worker_batch = None
+
+
+def _init_worker(shared, out):
+    global _worker_batch
+    _worker_batch = (shared, out)
+
+
+def _run_packed(chunk, batch=None):
+    packed, out = batch or _worker_batch
+    nautywrap.run_packed(packed, chunk[0], chunk[1], out)
+
+
+def parallel_map(func, graphs, processes=None):
+    '''
+    Compute certificates, canonical labelings or orbits of many graphs
+    with a pool of processes.
+
+    The graphs are packed once into a shared memory block, their
+    adjacency lists in compressed sparse row form, and the results
+    are written into another one: no Graph is pickled to the workers
+    and no result back. Where processes cannot be forked, as on
+    Windows, a pool of threads works on the shared blocks instead; the
+    searches run without holding the GIL.
+
+    *func*
+        What to compute for each graph: certificate or canon_label,
+        either pynauty's function or its name, or 'orbits' for the orbits
+        of the automorphism group as in autgrp(). The searches run
+        dense nauty and certificates are in the 'raw' format.
+
+    *graphs*
+        An iterable of Graph objects, without edge colors.
+
+    *processes*
+        The number of worker processes. Optional, default is None,
+        the number of CPUs. With 1 the graphs are processed in the
+        calling process.
+
+    return ->
+        The list of results in the order of *graphs*, each one the
+        same as func(g) returns.
+    '''
+    if func is certificate or func is canon_label:
+        func = func.__name__
+    kind = _packed_kinds.get(func) if isinstance(func, str) else None
+    if kind is None:
+        raise ValueError(
+            "func must be certificate, canon_label or 'orbits'")
+    graphs = list(graphs)
+    for g in graphs:
+        if not isinstance(g, _graph_types):
+            raise TypeError
+    if processes is None:
+        processes = os.cpu_count() or 1
+    packed, offsets = nautywrap.pack_graphs(graphs, kind)
+    shared = mmap.mmap(-1, len(packed))
+    shared[:] = packed
+    del packed
+    out = mmap.mmap(-1, max(offsets[-1], 1))
+
+    # a few chunks per worker to even out their load
+    size = max(1, len(graphs) // (4 * processes))
+    chunks = [(i, min(i + size, len(graphs)))
+              for i in range(0, len(graphs), size)]
+    # the blocks are inherited by forked workers, never pickled, and
+    # bound to the tasks elsewhere: concurrent calls do not share them
+    if processes <= 1 or len(chunks) <= 1:
+        for chunk in chunks:
+            _run_packed(chunk, (shared, out))
+    elif 'fork' in multiprocessing.get_all_start_methods():
+        with multiprocessing.get_context('fork').Pool(
+                processes, _init_worker, (shared, out)) as pool:
+            pool.map(_run_packed, chunks)
+    else:
+        with multiprocessing.pool.ThreadPool(processes) as pool:
+            pool.map(functools.partial(_run_packed, batch=(shared, out)),
+                     chunks)
+
+    if kind == 0:
+        results = [out[offsets[i]:offsets[i + 1]]
+                   for i in range(len(graphs))]
+    else:
+        ints = array.array('i', out[:offsets[-1]])
+        offsets = [x // ints.itemsize for x in offsets]
+        ints = ints.tolist()
+        results = [ints[offsets[i]:offsets[i + 1]]
+                   for i in range(len(graphs))]
+    shared.close()
+    out.close()
+    return results
 
 
-def canon_label(g):
+def canon_label(g, mode='dense', cache=None):
     '''
     Finds the canonical labeling of vertices.
 
     *g*
         A Graph object.
 
+    *mode*
+        The search engine, see autgrp(). Labelings computed in
+        different modes are not comparable. Optional, default is
+        'dense'.
+
+    *cache*
+        A CertCache to look the graph up in first, and to store the
+        labeling in. Optional, default is None.
+
     return ->
         A list with each node relabelled.
     '''
-    if not isinstance(g, Graph):
+    if not isinstance(g, _graph_types):
         raise TypeError
-    return nautywrap.graph_canonlab(g)
+    if cache is not None:
+        label = _cached(cache, g, 'label:%s:' % mode,
+                        lambda: array.array(
+                            'i', nautywrap.graph_canonlab(g, mode)
+                        ).tobytes())
+        return array.array('i', label).tolist()
+    return nautywrap.graph_canonlab(g, mode)
 
 
-# This is a temporary pure Python solution due to @rburing
-# It should be implemented in C for efficiency. 
-def canon_graph(g):
+def canon_graph(g, mode='dense'):
     '''
     Compute the canonically labeled version of graph g.
 
     *g*
         A Graph object.
 
+    *mode*
+        The search engine, see autgrp(). Canonical graphs computed in
+        different modes are not comparable. Optional, default is
+        'dense'.
+
     return ->
-        new canonical graph.
+        new canonical graph. Vertex i of it is vertex canon_label(g)[i]
+        of *g*, and the vertex and edge colorings of *g* are carried
+        over.
     '''
-    if g.vertex_coloring:
-        raise RuntimeError("canon_graph() is not implemented for vertex-colored graphs yet.")
-    c = certificate(g)
-    set_length = len(c) // g.number_of_vertices
-    sets = [c[set_length*k:set_length*(k+1)] for k in range(g.number_of_vertices)]
-    neighbors = [[i for i in range(set_length * 8) if st[-1 - i//8] & (1 << (7 - i%8))] for st in sets]
-    return Graph(number_of_vertices=g.number_of_vertices, directed=g.directed,
-                 adjacency_dict={i: neighbors[i] for i in range(g.number_of_vertices)})
+    if not isinstance(g, _graph_types):
+        raise TypeError
+    if isinstance(g, Graph) and g.edge_colors:
+        # the layered graph is not returned by nauty: relabel g itself
+        position = [0] * g.number_of_vertices
+        for i, v in enumerate(canon_label(g, mode)):
+            position[v] = i
+        adjacency = collections.defaultdict(set)
+        for (x, y) in list(_edges(g)) + list(g.edge_colors):
+            adjacency[position[x]].add(position[y])
+            if not g.directed:
+                adjacency[position[y]].add(position[x])
+        return type(g)(
+            g.number_of_vertices, g.directed,
+            dict((v, sorted(adjacency[v]))
+                 for v in range(g.number_of_vertices)),
+            [set(position[v] for v in part) for part in g.vertex_coloring],
+            dict(((position[x], position[y]), c)
+                 for (x, y), c in g.edge_colors.items()))
+    return nautywrap.graph_canongraph(g, mode)
+
+
+def _edges(g):
+    for x, ys in g.adjacency_dict.items():
+        for y in ys:
+            yield x, y
 
 
 def isomorphic(a, b):
@@ -248,7 +1054,32 @@ def isomorphic(a, b):
     elif list(map(len, a.vertex_coloring)) != list(map(len, b.vertex_coloring)):
         return False
     else:
-        return certificate(a) == certificate(b)
+        return isomorphism(a, b) is not None
+
+
+def isomorphism(a, b, mode='dense'):
+    '''
+    Find an isomorphism between two graphs.
+
+    Cheap invariants are compared first: the sizes of the color
+    classes, the degrees within them and the equitable partition
+    refined from the coloring. Only if those agree are both graphs
+    canonically labeled.
+
+    *a,b*
+        Two Graph objects. The isomorphism maps the i-th part of the
+        vertex coloring of *a* to the i-th part of that of *b*.
+
+    *mode*
+        The search engine, see autgrp(). Optional, default is 'dense'.
+
+    return ->
+        A list mapping vertex v of *a* to vertex result[v] of *b*, or
+        None if *a* and *b* are not isomorphic.
+    '''
+    if not isinstance(a, _graph_types) or not isinstance(b, _graph_types):
+        raise TypeError
+    return nautywrap.graph_isomorphism(a, b, mode)
 
 
 def delete_random_edge(g):
@@ -261,21 +1092,54 @@ def delete_random_edge(g):
     return ->
         The deleted edge as a tuple or (None, None) if no edge is left.
     '''
-    if g.adjacency_dict:
+    adjacency_dict = g.adjacency_dict
+    if adjacency_dict:
         # pick a random vertex 'x' which is connected
-        x = random.sample(list(g.adjacency_dict), 1)[0]
+        x = random.sample(list(adjacency_dict), 1)[0]
         # remove a random edge connected to 'x'
-        xs = g.adjacency_dict[x]
+        xs = adjacency_dict[x]
         y = xs.pop(random.randrange(len(xs)))
         if not xs:
-            g.adjacency_dict.pop(x)
+            adjacency_dict.pop(x)
         # if g is not directed make sure to remove edge completely
-        if (not g.directed) and y in g.adjacency_dict:
-            ys = g.adjacency_dict[y]
+        if (not g.directed) and y in adjacency_dict:
+            ys = adjacency_dict[y]
             if x in ys:
                 ys.remove(x)
     else:
         # the graph has no edges
         x, y = None, None
+    if isinstance(g, CompactGraph):
+        # its adjacency_dict is a copy
+        g.set_adjacency_dict(adjacency_dict)
     return (x, y)
 
+
+def select_mode(g):
+    '''
+    Return the search engine mode='auto' uses for a graph.
+
+    *g*
+        A Graph object.
+
+    return ->
+        One of 'dense', 'sparse' or 'traces'. Small graphs and
+        irregular graphs of moderate size go to 'dense'. Large or low
+        degree graphs go to 'traces', or to 'sparse' if directed, and so
+        do graphs whose degrees do not split the vertex coloring. The
+        choice depends only on isomorphism invariants, so certificates
+        computed with mode='auto' are comparable with each other.
+    '''
+    if not isinstance(g, _graph_types):
+        raise TypeError
+    return nautywrap.graph_mode(g)
+
+
+def clear_cache():
+    '''
+    Free the memory kept for reuse between calls.
+
+    Nauty's data structures for small graphs are not freed after a
+    call but kept for the next call on a graph of the same size.
+    '''
+    nautywrap.clear_cache()
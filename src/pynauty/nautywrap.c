@@ -17,6 +17,13 @@ GNU General Public License for more details.
 #include <nauty.h>
 #include <nautywrap.h>
 
+// nauty keeps its search state in static variables; these are only
+// private to a thread when the nauty objects are built with USE_TLS,
+// which is a prerequisite for running nauty() without the GIL.
+#if !HAVE_TLS
+#error "nauty must be configured with --enable-tls (try: make clean-nauty)"
+#endif
+
 
 //  static global (yuck) variables  -------------------------------------------
 
@@ -25,12 +32,161 @@ GNU General Public License for more details.
 //
 static DEFAULTOPTIONS(default_options);
 
-// a static global handle the current NyGraph object
-// needed since there is no way to pass this parameter to store_generator()
-static NyGraph *GRAPH_PTR;
+// NyGraph objects kept for reuse by acquire_nygraph(), the most
+// recently released one last; protected by the GIL
+static NyGraph *NYGRAPH_POOL[NYGRAPH_POOL_SIZE];
+static int NYGRAPH_POOL_LENGTH = 0;
+
+// the search nauty() is running in the current thread
+// needed since there is no way to pass a context to store_generator();
+// each search lives on the stack of its caller, so concurrent searches
+// in different threads never share it
+static TLS_ATTR NySearch *ACTIVE_SEARCH;
+
+// nauty_kill_request stops the searches of all threads, not only one:
+// the number of searches that set it, each clears it when it is the
+// last, and the other searches it stopped are run again, unless they
+// have streamed generators already
+static pthread_mutex_t KILL_LOCK = PTHREAD_MUTEX_INITIALIZER;
+static int KILL_OWNERS = 0;
+
+#if PY_MAJOR_VERSION < 3
+#define PyExc_TimeoutError PyExc_RuntimeError
+#endif
 
 //  Utilities  ================================================================
 
+static double monotonic_time(void)
+// seconds on a clock that is not set back
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+
+static double thread_cpu_time(void)
+// CPU seconds used by the current thread
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+    return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+
+static void abort_search(NySearch *s, int reason)
+// Stop the search s with nauty_kill_request, from any thread.
+{
+    pthread_mutex_lock(&KILL_LOCK);
+    if (!s->aborted) s->aborted = reason;
+    if (!s->killing) {
+        s->killing = TRUE;
+        KILL_OWNERS++;
+        nauty_kill_request = 1;
+    }
+    pthread_mutex_unlock(&KILL_LOCK);
+}
+
+
+static void release_kill(NySearch *s)
+// Clear nauty_kill_request if s set it and no other search needs it.
+{
+    pthread_mutex_lock(&KILL_LOCK);
+    if (s->killing) {
+        if (--KILL_OWNERS == 0) nauty_kill_request = 0;
+        s->killing = FALSE;
+    }
+    pthread_mutex_unlock(&KILL_LOCK);
+}
+
+
+static void * watch_search(void *arg)
+// the watchdog thread: abort the search once its timeout expires
+// unless it is done before
+{
+    NyWatchdog *w = arg;
+    struct timespec t;
+    double when;
+
+    clock_gettime(CLOCK_REALTIME, &t);
+    when = t.tv_sec + 1e-9 * t.tv_nsec + w->search->timeout;
+    t.tv_sec = (time_t) when;
+    t.tv_nsec = (long) ((when - (double) t.tv_sec) * 1e9);
+
+    pthread_mutex_lock(&w->lock);
+    while (!w->done) {
+        if (pthread_cond_timedwait(&w->cond, &w->lock, &t) == ETIMEDOUT) {
+            if (!w->done) abort_search(w->search, NY_ABORT_TIMEOUT);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&w->lock);
+    return NULL;
+}
+
+
+static void check_node(graph *g, int *lab, int *ptn, int level,
+        int numcells, int tc, int code, int m, int n)
+// this function is called by nauty at each node of the search tree;
+// it enforces max_nodes and runs the Python signal handlers every
+// SIGNAL_CHECK_INTERVAL seconds.
+{
+    NySearch *s = ACTIVE_SEARCH;
+    PyGILState_STATE state;
+    double now;
+
+    if (s->aborted) return;
+    if (++s->no_nodes > s->max_nodes && s->max_nodes > 0) {
+        abort_search(s, NY_ABORT_NODES);
+        return;
+    }
+    if (!s->check_signals) return;
+    now = monotonic_time();
+    if (now - s->checked >= SIGNAL_CHECK_INTERVAL) {
+        s->checked = now;
+        state = PyGILState_Ensure();
+        if (PyErr_CheckSignals() < 0) {
+            PyErr_Fetch(&s->exc_type, &s->exc_value, &s->exc_traceback);
+            abort_search(s, NY_ABORT_EXCEPTION);
+        }
+        PyGILState_Release(state);
+    }
+}
+
+
+static void stream_generator(NySearch *s, permutation *perm, int n)
+// Pass a generator to the callback of s, holding the GIL for the call.
+{
+    PyGILState_STATE state;
+    PyObject *py_perm;
+    PyObject *vertex;
+    PyObject *result = NULL;
+    int j;
+
+    state = PyGILState_Ensure();
+    if ((py_perm = PyList_New(n)) != NULL) {
+        for (j = 0; j < n; j++) {
+            if ((vertex = PyLong_FromLong(perm[j])) == NULL) {
+                Py_CLEAR(py_perm);
+                break;
+            }
+            PyList_SET_ITEM(py_perm, j, vertex);
+        }
+    }
+    if (py_perm != NULL) {
+        result = PyObject_CallFunctionObjArgs(s->callback, py_perm, NULL);
+        Py_DECREF(py_perm);
+    }
+    if (result == NULL) {
+        PyErr_Fetch(&s->exc_type, &s->exc_value, &s->exc_traceback);
+    }
+    Py_XDECREF(result);
+    PyGILState_Release(state);
+}
+
+
 static void store_generator(int count,
         permutation *perm,
         int *orbits,
@@ -40,50 +196,74 @@ static void store_generator(int count,
 // this function is called by nauty every time a new generator
 // of the automorphismgroup of the graph found.
 {
-    NyGraph *g = GRAPH_PTR;
-    int i;
-    permutation *p;
-    permutation **new;
+    NySearch *s = ACTIVE_SEARCH;
+    NyGraph *g = s->graph;
+    permutation *new;
+    int max;
+    int base = g->no_base_vertices;
 
-    if ((p = malloc(n * sizeof(permutation))) == NULL) {
-        fprintf(stderr, "Failed to allocate memory for generator #%d.\n",
-                g->no_generators);
-        exit(1);
+    // streamed generators are restricted to the vertices given, the
+    // first layer if the graph was layered
+    if (s->callback != NULL) {
+        if (s->aborted) return;
+        stream_generator(s, perm, base);
+        if (s->exc_type != NULL) abort_search(s, NY_ABORT_EXCEPTION);
+        s->no_streamed++;
+        return;
     }
-
-    for (i=0; i < n; i++) {
-        p[i] = perm[i];
+    if (s->slots != NULL) {
+        memcpy(s->slots + (size_t) (s->no_streamed % s->no_slots) * base,
+                perm, base * sizeof(permutation));
+        s->no_streamed++;
+        return;
     }
-    g->generator[g->no_generators] = p;
-    g->no_generators++;
 
     if (g->no_generators >= g->max_no_generators) {
-        // allocate a larger array
-        g->max_no_generators += NUM_GENS_INCR;
-        new=(permutation **)malloc(g->max_no_generators * sizeof(permutation*));
+        // allocate a larger block, keeping the old one on failure
+        max = g->max_no_generators ? 2 * g->max_no_generators : NUM_GENS_INIT;
+        new = realloc(g->generators, (size_t) max * n * sizeof(permutation));
         if (new == NULL) {
-            fprintf(stderr, "Failed to allocate extension for generators.\n");
-            exit(1);
+            // reported as a MemoryError once the search is over
+            g->generators_lost = TRUE;
+            return;
         }
-        // copy over the old one
-        for (i = 0; i < g->no_generators; i++) {
-            new[i] = g->generator[i];
-        }
-        // free the old generator array
-        free(g->generator);
-        // switch to the new one
-        g->generator = new;
+        g->generators = new;
+        g->max_no_generators = max;
+    }
+
+    memcpy(g->generators + (size_t) g->no_generators * n, perm,
+            n * sizeof(permutation));
+    g->no_generators++;
+}
+
+
+static void store_level(int *lab, int *ptn, int level, int *orbits,
+        statsblk *stats, int tv, int index, int tcellsize, int numcells,
+        int childcount, int n)
+// this function is called by nauty for each level of the first path
+// of the search tree, bottom up; index is the size of the orbit of tv
+// under the stabilizer of the levels above it.
+{
+    NyGraph *g = ACTIVE_SEARCH->graph;
+
+    if (g->no_levels <= g->no_vertices) {
+        g->level_index[g->no_levels++] = index;
     }
 }
 
 
+static void store_traces_generator(int count, int *perm, int n)
+// the same as store_generator() for Traces
+{
+    store_generator(count, perm, NULL, 0, 0, n);
+}
+
+
 void destroy_nygraph(NyGraph *g)
 //
 // free all the allocated memory for NyGraph
 //
 {
-    int i;
-
     free(g->options);
     free(g->matrix);
     free(g->cmatrix);
@@ -92,19 +272,63 @@ void destroy_nygraph(NyGraph *g)
     free(g->orbits);
     free(g->stats);
     free(g->workspace);
+    free(g->generators);
+    free(g->level_index);
+    free(g->saved_partition);
+    SG_FREE(g->sg);
+    SG_FREE(g->csg);
+
+    free(g);
+}
+
+
+static void reset_nygraph(NyGraph *g)
+// Make g an edgeless, uncolored graph with the default options
+// and no generators collected.
+{
+    int i;
+
+    if (g->mode == NY_DENSE) {
+        for (i = 0; i < g->no_vertices; i++) {
+            EMPTYSET((GRAPHROW(g->matrix, i, g->no_setwords)),
+                    g->no_setwords);
+        }
+    } else {
+        g->sg.nv = g->no_vertices;
+        g->sg.nde = 0;
+        for (i = 0; i < g->no_vertices; i++) {
+            g->sg.v[i] = 0;
+            g->sg.d[i] = 0;
+        }
+    }
 
-    for (i = 0; i < g->no_generators; i++) {
-        free(g->generator[i]);
+    memcpy(g->options, &default_options, sizeof(optionblk));
+    if (g->mode != NY_DENSE) {
+        g->options->dispatch = &dispatch_sparse;
     }
-    free(g->generator);
 
-    free(g);
+    g->options->digraph = FALSE;
+    g->options->getcanon = FALSE;
+    g->options->defaultptn = TRUE;      // default is no coloring
+    g->options->writeautoms = FALSE;
+    g->options->cartesian = TRUE;
+    g->options->linelength = 0;
+    g->options->userautomproc = store_generator;
+    g->options->userlevelproc = store_level;
+    g->options->usernodeproc = check_node;
+
+    g->no_generators = 0;
+    g->generators_lost = FALSE;
+    g->no_levels = 0;
+    g->schreier_fails = 0;
+    g->no_base_vertices = g->no_vertices;
 }
 
 
-NyGraph * create_nygraph(int no_vertices)
+NyGraph * create_nygraph(int no_vertices, int mode)
 //
 // Allocate a data structure to hold all data structures used by Nauty
+// with the given search engine
 //
 {
     NyGraph *g;
@@ -123,23 +347,33 @@ NyGraph * create_nygraph(int no_vertices)
     g->workspace = NULL;
     g->max_no_generators = 0;
     g->no_generators = 0;
-    g->generator = NULL;
+    g->generators = NULL;
+    g->level_index = NULL;
+    g->saved_partition = NULL;
+    SG_INIT(g->sg);
+    SG_INIT(g->csg);
 
+    g->mode = mode;
     g->no_vertices = no_vertices;
     g->no_setwords = (no_vertices + WORDSIZE - 1) / WORDSIZE;
     nauty_check(WORDSIZE, g->no_setwords, g->no_vertices, NAUTYVERSIONID);
 
-    if ((g->matrix = malloc((size_t) g->no_setwords *
-                    (size_t) (no_vertices * sizeof(setword)))) == NULL) {
-        destroy_nygraph(g);
-        return NULL;
-    }
-    for (i = 0; i < no_vertices; i++) {
-        EMPTYSET((GRAPHROW(g->matrix, i, g->no_setwords)), g->no_setwords);
+    if (mode == NY_DENSE) {
+        if ((g->matrix = malloc((size_t) g->no_setwords *
+                        (size_t) (no_vertices * sizeof(setword)))) == NULL) {
+            destroy_nygraph(g);
+            return NULL;
+        }
+    } else {
+        // the edges are allocated when they are known
+        if ((g->sg.v = malloc((no_vertices + 1) * sizeof(size_t))) == NULL ||
+                (g->sg.d = malloc((no_vertices + 1) * sizeof(int))) == NULL) {
+            destroy_nygraph(g);
+            return NULL;
+        }
+        g->sg.vlen = g->sg.dlen = no_vertices + 1;
     }
 
-    g->cmatrix = NULL;
-
     if ((g->lab = malloc(no_vertices * sizeof(int))) == NULL) {
         destroy_nygraph(g);
         return NULL;
@@ -162,32 +396,76 @@ NyGraph * create_nygraph(int no_vertices)
         destroy_nygraph(g);
         return NULL;
     }
-    memcpy(g->options, &default_options, sizeof(optionblk));
-
-    g->options->digraph = FALSE;
-    g->options->getcanon = FALSE;
-    g->options->defaultptn = TRUE;      // default is no coloring
-    g->options->writeautoms = FALSE;
-    g->options->cartesian = TRUE;
-    g->options->linelength = 0;
-    g->options->userautomproc = store_generator;
 
     if ((g->stats = malloc(sizeof(statsblk))) == NULL) {
         destroy_nygraph(g);
         return NULL;
     }
 
-    g->worksize = WORKSPACE_FACTOR * g->no_setwords;
-    if ((g->workspace = malloc(g->worksize * sizeof(setword))) == NULL) {
+    if ((g->level_index = malloc((no_vertices + 1) * sizeof(int))) == NULL) {
+        destroy_nygraph(g);
+        return NULL;
+    }
+
+    if ((g->saved_partition = malloc((2 * (size_t) no_vertices + 1) *
+                    sizeof(int))) == NULL) {
+        destroy_nygraph(g);
+        return NULL;
+    }
+
+    // sparsenauty() and Traces() allocate their own workspace
+    g->worksize = mode == NY_DENSE ? WORKSPACE_FACTOR * g->no_setwords : 0;
+    if ((g->workspace = malloc((g->worksize + 1) * sizeof(setword))) == NULL) {
         destroy_nygraph(g);
         return NULL;
     }
 
-    GRAPH_PTR = g;
+    reset_nygraph(g);
     return g;
 }
 
 
+NyGraph * acquire_nygraph(int no_vertices, int mode)
+// Take a NyGraph for no_vertices vertices and the given search engine
+// out of the pool or create a new one when there is none.
+// Must be called holding the GIL.
+{
+    NyGraph *g;
+    int i;
+
+    for (i = NYGRAPH_POOL_LENGTH - 1; i >= 0; i--) {
+        g = NYGRAPH_POOL[i];
+        if (g->no_vertices == no_vertices && g->mode == mode &&
+                g->no_setwords == (no_vertices + WORDSIZE - 1) / WORDSIZE) {
+            NYGRAPH_POOL_LENGTH--;
+            memmove(&NYGRAPH_POOL[i], &NYGRAPH_POOL[i+1],
+                    (NYGRAPH_POOL_LENGTH - i) * sizeof(NyGraph *));
+            reset_nygraph(g);
+            return g;
+        }
+    }
+    return create_nygraph(no_vertices, mode);
+}
+
+
+void release_nygraph(NyGraph *g)
+// Return g to the pool, evicting the least recently released NyGraph
+// if the pool is full.  Must be called holding the GIL.
+{
+    if (g->no_vertices > NYGRAPH_POOL_MAX_VERTICES) {
+        destroy_nygraph(g);
+        return;
+    }
+    if (NYGRAPH_POOL_LENGTH == NYGRAPH_POOL_SIZE) {
+        destroy_nygraph(NYGRAPH_POOL[0]);
+        NYGRAPH_POOL_LENGTH--;
+        memmove(&NYGRAPH_POOL[0], &NYGRAPH_POOL[1],
+                NYGRAPH_POOL_LENGTH * sizeof(NyGraph *));
+    }
+    NYGRAPH_POOL[NYGRAPH_POOL_LENGTH++] = g;
+}
+
+
 void make_edge(NyGraph *g, int i, int j)
     // connect vertex i to vertex j with an edge
     // if the graph is directed that means the edge (i)----->(j)
@@ -201,394 +479,4325 @@ void make_edge(NyGraph *g, int i, int j)
 
 NyGraph * extend_canonical(NyGraph *g)
 // extend the NyGraph structure with cmatrix to hold
-// the canonically labeled graph
+// the canonically labeled graph, unless it already has one
+// (the canonical sparsegraph is allocated by nauty itself)
 {
-    if ((g->cmatrix = malloc(g->no_setwords * g->no_vertices * WORDSIZE))
-            == NULL) {
-        destroy_nygraph(g);
+    if (g->mode == NY_DENSE && g->cmatrix == NULL &&
+            (g->cmatrix = malloc((size_t) g->no_setwords *
+                    (size_t) (g->no_vertices * sizeof(setword)))) == NULL) {
         return NULL;
     }
     return g;
 }
 
 
-//  Python functions  =========================================================
-
-static int set_partition(PyObject *py_graph, int *lab, int *ptn)
-// Convert the vertex_coloring attribute of a NyGraph object
-// into nauty (lab, ptn) data structure at partition level 0
+static void traces_nygraph(NyGraph *g)
+// Run Traces on the sparsegraph of g with the options of g and report
+// the results in g->stats as nauty() would.
 {
-    PyObject *partition;
-    PyObject *pyset;
-    PyObject *iterator;
-    PyObject *item;
-    int no_parts;
-    int i;
-    int n;
-    int x;
+    DEFAULTOPTIONS_TRACES(options);
+    TracesStats stats;
 
-    if ( !(partition = PyObject_GetAttrString(py_graph, "vertex_coloring")) ) {
-        PyErr_SetString(PyExc_TypeError,
-                "missing 'vertex_coloring' attribute");
-        return 0;       // error
+    options.getcanon = g->options->getcanon;
+    options.defaultptn = g->options->defaultptn;
+    if (g->options->userautomproc != NULL) {
+        options.userautomproc = store_traces_generator;
     }
 
-    if ((no_parts = PyObject_Length(partition)) <= 0) {
-        Py_DECREF(partition);
-        return -1;      // no coloring
+    memset(g->stats, 0, sizeof(statsblk));
+    if (g->no_vertices == 0) {
+        // Traces cannot cope with the empty graph
+        g->stats->grpsize1 = 1.0;
+        g->csg.nv = 0;
+        g->csg.nde = 0;
+        return;
     }
 
-    for (i = n = 0; i < no_parts; i++) {
-        pyset = PyList_GET_ITEM(partition, i);
-        iterator = PyObject_GetIter(pyset);
-        
-        while ((item = PyIter_Next(iterator))) {
-#if PY_MAJOR_VERSION >= 3
-            x = PyLong_AS_LONG(item);
-#else
-            x = PyInt_AS_LONG(item);
-#endif
-            Py_DECREF(item);
-            lab[n] = x;
-            ptn[n++] = 1;
-        }
-        if (n > 0) {
-            ptn[n-1] = 0;
+    Traces(&g->sg, g->lab, g->ptn, g->orbits, &options, &stats,
+            options.getcanon ? &g->csg : NULL);
+
+    g->stats->grpsize1 = stats.grpsize1;
+    g->stats->grpsize2 = stats.grpsize2;
+    g->stats->numorbits = stats.numorbits;
+    g->stats->numgenerators = stats.numgenerators;
+    g->stats->errstatus = stats.errstatus;
+    g->stats->numnodes = stats.numnodes;
+    g->stats->canupdates = stats.canupdates;
+    g->stats->maxlevel = stats.treedepth;
+}
+
+
+static void run_search(NySearch *search)
+// Run nauty on the graph of search in the current thread, again if
+// another thread killed it.  Does not touch the GIL.
+{
+    NyGraph *g = search->graph;
+    NySearch *outer;
+    struct timespec pause = {0, 1000000};
+    int n = g->no_vertices;
+    double start = monotonic_time(), cpu_start = thread_cpu_time();
+
+    outer = ACTIVE_SEARCH;
+    ACTIVE_SEARCH = search;
+    memcpy(g->saved_partition, g->lab, n * sizeof(int));
+    memcpy(g->saved_partition + n, g->ptn, n * sizeof(int));
+    // a per-thread setting of schreier.c
+    if (g->options->schreier) schreier_fails(g->schreier_fails);
+    for (;;) {
+        g->no_levels = 0;
+        switch (g->mode) {
+        case NY_SPARSE:
+            sparsenauty(&g->sg, g->lab, g->ptn, g->orbits, g->options,
+                    g->stats, g->options->getcanon ? &g->csg : NULL);
+            break;
+        case NY_TRACES:
+            traces_nygraph(g);
+            break;
+        default:
+            nauty(g->matrix, g->lab, g->ptn, NULL, g->orbits,
+                    g->options, g->stats,  g->workspace, g->worksize,
+                    g->no_setwords, g->no_vertices, g->cmatrix);
         }
+        if (g->stats->errstatus != NAUKILLED || search->aborted) break;
 
-        Py_DECREF(iterator);
+        // killed for another search; the generators already streamed
+        // cannot be taken back, so such a search is not run again
+        if (search->no_streamed > 0) {
+            search->aborted = NY_ABORT_INTERRUPTED;
+            break;
+        }
+        // wait for the other search to finish and restart, unless this
+        // one is aborted meanwhile: it may then hold the request itself
+        while (nauty_kill_request && !search->aborted) {
+            nanosleep(&pause, NULL);
+        }
+        if (search->aborted) break;
+        memcpy(g->lab, g->saved_partition, n * sizeof(int));
+        memcpy(g->ptn, g->saved_partition + n, n * sizeof(int));
+        g->no_generators = 0;
+        g->generators_lost = FALSE;
+        search->no_nodes = 0;
     }
+    release_kill(search);
+    ACTIVE_SEARCH = outer;
+    g->search_time = monotonic_time() - start;
+    g->search_cpu_time = thread_cpu_time() - cpu_start;
+}
 
-    Py_DECREF(partition);
 
-    return 1;           // coloring
+static void search_nygraph(NyGraph *g)
+// Run nauty on g in the current thread, storing the generators in g.
+// Does not touch the GIL.
+{
+    NySearch search;
+
+    memset(&search, 0, sizeof(search));
+    search.graph = g;
+    run_search(&search);
 }
 
 
-static PyObject* py_auto_group(NyGraph *g)
-// convert generators, orbits etc. into Python representation
-// and return it in a tuple:
-//      (generators, order, orbits, orbit_no)
+static void init_search(NySearch *search, NyGraph *g, double timeout,
+        long max_nodes)
+// Prepare a search of g from Python within the given budget, 0 for
+// none.
 {
-    int i, j;
-    PyObject *py_autgrp;
-    PyObject *py_gens;
-    PyObject *py_perm;
-    PyObject *py_orbits;
-    PyObject *py_grpsize1;
-    PyObject *py_grpsize2;
+    memset(search, 0, sizeof(*search));
+    search->graph = g;
+    search->check_signals = TRUE;
+    search->checked = monotonic_time();
+    if (timeout > 0) search->timeout = timeout;
+    if (max_nodes > 0) search->max_nodes = max_nodes;
+}
 
-    // generators
-    py_gens = PyList_New(g->no_generators);
-    for (i=0; i < g->no_generators; i++) {
-        py_perm = PyList_New(g->no_vertices);
-        for (j=0; j < g->no_vertices; j++) {
-            PyList_SetItem(py_perm, j,
-                    Py_BuildValue("i", g->generator[i][j]));
+
+static int run_checked(NySearch *search)
+// Run a search prepared by init_search() with the GIL released so that
+// other Python threads can proceed.  Return 0 if it ran to completion,
+// -1 with a Python exception set if it was cut short.
+{
+    NyWatchdog w;
+
+    if (search->max_nodes > 0 && search->graph->mode == NY_TRACES) {
+        PyErr_SetString(PyExc_ValueError,
+                "Traces cannot count nodes, max_nodes needs nauty");
+        return -1;
+    }
+    if (search->timeout > 0) {
+        w.search = search;
+        w.done = FALSE;
+        pthread_mutex_init(&w.lock, NULL);
+        pthread_cond_init(&w.cond, NULL);
+        if (pthread_create(&w.thread, NULL, watch_search, &w) != 0) {
+            PyErr_SetString(PyExc_RuntimeError,
+                    "cannot start the timeout thread");
+            return -1;
         }
-        PyList_SetItem(py_gens, i, py_perm);
     }
 
-    // group order
-    //
-    // "the order of the autgrp is equal to
-    //      grpsize1 * 10^grpsize2
-    // within rounding error" -- Nauty manual
-    //
-    py_grpsize1 = Py_BuildValue("d", g->stats->grpsize1);
-    py_grpsize2 = Py_BuildValue("i", g->stats->grpsize2);
+    Py_BEGIN_ALLOW_THREADS
+    run_search(search);
+    if (search->timeout > 0) {
+        pthread_mutex_lock(&w.lock);
+        w.done = TRUE;
+        pthread_cond_signal(&w.cond);
+        pthread_mutex_unlock(&w.lock);
+        pthread_join(w.thread, NULL);
+        pthread_mutex_destroy(&w.lock);
+        pthread_cond_destroy(&w.cond);
+        // the watchdog may have fired after run_search() returned
+        release_kill(search);
+    }
+    Py_END_ALLOW_THREADS
 
-    // orbits
-    py_orbits = PyList_New(g->no_vertices);
-    for (i=0; i < g->no_vertices; i++) {
-        PyList_SetItem(py_orbits, i, Py_BuildValue("i", g->orbits[i]));
+    switch (search->aborted) {
+    case 0:
+        return 0;
+    case NY_ABORT_NODES:
+        PyErr_Format(PyExc_TimeoutError,
+                "nauty search exceeded max_nodes=%lu", search->max_nodes);
+        return -1;
+    case NY_ABORT_TIMEOUT:
+        PyErr_SetString(PyExc_TimeoutError, "nauty search timed out");
+        return -1;
+    case NY_ABORT_INTERRUPTED:
+        PyErr_Format(PyExc_RuntimeError,
+                "nauty search stopped by the timeout or max_nodes of "
+                "another search after streaming %ld generators",
+                search->no_streamed);
+        return -1;
     }
+    PyErr_Restore(search->exc_type, search->exc_value,
+            search->exc_traceback);
+    return -1;
+}
 
-    // create return value tuple:
-    //      (generators, grpsize1, grpsize2, orbits, orbit_no)
-    py_autgrp = PyTuple_New(5);
-    PyTuple_SetItem(py_autgrp, 0, py_gens);
-    PyTuple_SetItem(py_autgrp, 1, py_grpsize1);
-    PyTuple_SetItem(py_autgrp, 2, py_grpsize2);
-    PyTuple_SetItem(py_autgrp, 3, py_orbits);
-    PyTuple_SetItem(py_autgrp, 4, Py_BuildValue("i", g->stats->numorbits));
 
-    return py_autgrp;
+static int run_nauty(NyGraph *g)
+// Run nauty on g with the GIL released, see run_checked().  The caller
+// must hold the GIL and must not touch Python objects from nauty's
+// callbacks.
+{
+    NySearch search;
+
+    init_search(&search, g, 0, 0);
+    return run_checked(&search);
 }
 
 
-NyGraph * _make_nygraph(PyObject *py_graph)
-// Convert the Python NyGraph object into a Nauty/C NyGraph object
-// and set Nauty options.
+static int open_stream(NySearch *search, PyObject *on_generator,
+        Py_buffer *view)
+// Make search pass the generators to on_generator, a callable or a
+// writable buffer of C ints, rather than store them.  The buffer is
+// opened into view, to be released after the search if search->slots
+// is set.  Return -1 with a Python exception set on error.
 {
-    NyGraph *g;
-    int n;
-    set *rowp;
- 
-    PyObject *adjdict;
-    PyObject *key;
-    PyObject *adjlist;
-    PyObject *p;
-
-    int i;
-    int adjlist_length;
-    int x, y;
+    NyGraph *g = search->graph;
+    long size;
 
-    // get the number of vertices
-    if ((p = PyObject_GetAttrString(py_graph, "number_of_vertices")) == NULL) {
-        PyErr_SetString(PyExc_TypeError,
-                "Missing 'number_of_vertices' attribute");
-        return NULL;
+    if (PyCallable_Check(on_generator)) {
+        search->callback = on_generator;
+        return 0;
     }
-#if PY_MAJOR_VERSION >= 3
-    n = PyLong_AS_LONG(p);
-#else
-    n = PyInt_AS_LONG(p);
-#endif
-    Py_DECREF(p);
-
-    // create an empty Nauty NyGraph object
-    if ((g = create_nygraph(n)) == NULL) {
-        PyErr_SetString(PyExc_MemoryError, "Nauty NyGraph creation failed");
-        return NULL;
+    if (PyObject_GetBuffer(on_generator, view,
+                PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        PyErr_SetString(PyExc_TypeError, "on_generator must be "
+                "callable or a writable buffer of C ints");
+        return -1;
     }
-
-    // get directed attribute
-    if ((p = PyObject_GetAttrString(py_graph, "directed")) == NULL) {
-        PyErr_SetString(PyExc_TypeError, "missing 'directed' attribute");
-        return NULL;
+    size = g->no_base_vertices * (long) sizeof(int);
+    if (view->itemsize != sizeof(int) || view->format == NULL ||
+            strchr("iIlL", view->format[strlen(view->format) - 1]) == NULL ||
+            view->len < size) {
+        PyErr_Format(PyExc_ValueError, "on_generator must hold C ints, "
+                "at least number_of_vertices=%d of them",
+                g->no_base_vertices);
+        PyBuffer_Release(view);
+        return -1;
     }
-    if (PyObject_IsTrue(p)) {
-        g->options->digraph = TRUE;
+    search->slots = view->buf;
+    search->no_slots = size > 0 ? view->len / size : 1;
+    return 0;
+}
+
+
+//  Batch processing  =========================================================
+
+void destroy_packed(NyPacked *p)
+{
+    if (p == NULL) return;
+    free(p->edges);
+    free(p);
+}
+
+
+static void unpack_graph(NyGraph *g, NyPacked *p)
+// Load a packed graph into g, whose buffers must be large enough
+// for p->no_vertices, and set the options for canonical labeling.
+{
+    int i;
+    size_t k;
+
+    g->no_vertices = p->no_vertices;
+    g->no_setwords = (p->no_vertices + WORDSIZE - 1) / WORDSIZE;
+    for (i = 0; i < g->no_vertices; i++) {
+        EMPTYSET((GRAPHROW(g->matrix, i, g->no_setwords)), g->no_setwords);
+    }
+    g->options->digraph = p->digraph;
+    for (k = 0; k < p->no_edges; k++) {
+        make_edge(g, p->edges[2*k], p->edges[2*k+1]);
+    }
+
+    if (p->colored) {
+        memcpy(g->lab, p->lab, g->no_vertices * sizeof(int));
+        memcpy(g->ptn, p->ptn, g->no_vertices * sizeof(int));
+        g->options->defaultptn = FALSE;
     } else {
-        g->options->digraph = FALSE;
+        g->options->defaultptn = TRUE;
     }
-    Py_DECREF(p);
+    g->options->getcanon = TRUE;
+    g->options->userautomproc = NULL;
+}
+
 
-    // get the adjacency list dictionary object
-    if ((adjdict = PyObject_GetAttrString(py_graph, "adjacency_dict")) == NULL) {
-        PyErr_SetString(PyExc_TypeError, "missing 'adjacency_dict' attribute");
+static void * certificate_worker(void *arg)
+// Compute certificates of graphs of the batch until none is left.
+// Every worker uses a single NyGraph sized for the largest graph.
+{
+    NyBatch *b = (NyBatch *) arg;
+    NyGraph *g;
+    NyPacked *p;
+    int i;
+
+    if ((g = create_nygraph(b->max_vertices, NY_DENSE)) == NULL) return NULL;
+    if (extend_canonical(g) == NULL) {
+        destroy_nygraph(g);
         return NULL;
     }
 
-    // iterate over the adjacency list setting
-    // the adjacency matrix in the Nauty NyGraph g
-    Py_ssize_t pos = 0;
-    while (PyDict_Next(adjdict, &pos, &key, &adjlist)) {
-#if PY_MAJOR_VERSION >= 3
-        x = PyLong_AS_LONG(key);
-#else
-        x = PyInt_AS_LONG(key);
+    for (;;) {
+        pthread_mutex_lock(&b->lock);
+        i = b->next++;
+        pthread_mutex_unlock(&b->lock);
+        if (i >= b->no_graphs) break;
+
+        p = b->graphs[i];
+        unpack_graph(g, p);
+        search_nygraph(g);
+        memcpy(b->results[i], g->cmatrix,
+                g->no_vertices * g->no_setwords * sizeof(setword));
+
+        pthread_mutex_lock(&b->lock);
+        b->no_done++;
+        pthread_mutex_unlock(&b->lock);
+    }
+
+    destroy_nygraph(g);
+    return NULL;
+}
+
+
+static void free_thread_arrays(void)
+// Free the thread local work arrays of dense nauty, which would leak
+// when a thread that ran it ends.
+{
+    nauty_freedyn();
+    naugraph_freedyn();
+    nautil_freedyn();
+}
+
+
+static void * certificate_thread(void *arg)
+// certificate_worker() in a thread of its own, freeing what nauty
+// allocated in the thread before it ends
+{
+    certificate_worker(arg);
+    free_thread_arrays();
+    return NULL;
+}
+
+
+static void run_batch(NyBatch *b, int no_threads)
+// Work on the batch with no_threads threads, the calling one included.
+// Threads which cannot be started are simply left out.
+{
+    pthread_t *threads;
+    int i, started = 0;
+
+    if (no_threads > b->no_graphs) no_threads = b->no_graphs;
+    if (no_threads > 1 &&
+            (threads = malloc((no_threads-1) * sizeof(pthread_t))) != NULL) {
+        for (i = 0; i < no_threads - 1; i++) {
+            if (pthread_create(&threads[started], NULL,
+                        certificate_thread, b) == 0) {
+                started++;
+            }
+        }
+        certificate_worker(b);
+        for (i = 0; i < started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        free(threads);
+    } else {
+        certificate_worker(b);
+    }
+}
+
+
+//  Python functions  =========================================================
+
+static PyObject* py_generators(NyGraph *g)
+// the generators found by the search as a list of lists
+{
+    int i, j;
+    PyObject *py_gens;
+    PyObject *py_perm;
+
+    if (g->generators_lost) return PyErr_NoMemory();
+    py_gens = PyList_New(g->no_generators);
+    for (i=0; i < g->no_generators; i++) {
+        py_perm = PyList_New(g->no_base_vertices);
+        for (j=0; j < g->no_base_vertices; j++) {
+            PyList_SetItem(py_perm, j,
+                    Py_BuildValue("i",
+                        g->generators[(size_t) i * g->no_vertices + j]));
+        }
+        PyList_SetItem(py_gens, i, py_perm);
+    }
+    return py_gens;
+}
+
+
+static PyObject* py_int_list(int *array, int length)
+// a Python list of the ints of array, the orbits or lab of a NyGraph
+{
+    int i;
+    PyObject *py_list;
+
+    py_list = PyList_New(length);
+    for (i=0; i < length; i++) {
+        PyList_SetItem(py_list, i, Py_BuildValue("i", array[i]));
+    }
+    return py_list;
+}
+
+
+static int
+int_array_getbuffer(NyIntArray *self, Py_buffer *view, int flags)
+{
+    view->obj = (PyObject *) self;
+    Py_INCREF(self);
+    view->buf = self->data;
+    view->itemsize = sizeof(int);
+    view->len = self->shape[0] * self->shape[1] * sizeof(int);
+    view->readonly = 0;
+    view->format = flags & PyBUF_FORMAT ? "i" : NULL;
+    view->ndim = self->ndim;
+    view->shape = flags & PyBUF_ND ? self->shape : NULL;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ?
+        self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    return 0;
+}
+
+
+static Py_ssize_t
+int_array_length(NyIntArray *self)
+{
+    return self->shape[0];
+}
+
+
+static void
+int_array_dealloc(NyIntArray *self)
+{
+    free(self->data);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+
+static PyBufferProcs int_array_as_buffer = {
+#if PY_MAJOR_VERSION < 3
+    0, 0, 0, 0,
 #endif
-        adjlist_length =  PyObject_Length(adjlist);
-        rowp = GRAPHROW(g->matrix, x, g->no_setwords);
-        for (i=0; i < adjlist_length; i++) {
-            p = PyList_GET_ITEM(adjlist, i);
-#if PY_MAJOR_VERSION >= 3
-            y = PyLong_AS_LONG(p);
+    (getbufferproc) int_array_getbuffer,
+    NULL,
+};
+
+
+static PySequenceMethods int_array_as_sequence = {
+    .sq_length = (lenfunc) int_array_length,
+};
+
+
+static PyTypeObject NyIntArrayType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "nautywrap.IntArray",
+    .tp_doc = PyDoc_STR("A C int array, read with memoryview() or "
+            "numpy.asarray()"),
+    .tp_basicsize = sizeof(NyIntArray),
+    .tp_itemsize = 0,
+#if PY_MAJOR_VERSION < 3
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER,
 #else
-            y = PyInt_AS_LONG(p);
+    .tp_flags = Py_TPFLAGS_DEFAULT,
 #endif
-            ADDELEMENT(rowp, y);
-            if (g->options->digraph == FALSE) {
-                ADDELEMENT((GRAPHROW(g->matrix, y, g->no_setwords)), x);
-            }
+    .tp_dealloc = (destructor) int_array_dealloc,
+    .tp_as_buffer = &int_array_as_buffer,
+    .tp_as_sequence = &int_array_as_sequence,
+};
+
+
+static PyObject* new_int_array(int *data, Py_ssize_t rows, Py_ssize_t cols)
+// An IntArray taking over data, a block of rows * cols ints from
+// malloc(); 1-dimensional if cols < 0.  data is freed on failure.
+{
+    NyIntArray *a;
+
+    if ((a = PyObject_New(NyIntArray, &NyIntArrayType)) == NULL) {
+        free(data);
+        return NULL;
+    }
+    a->data = data;
+    a->ndim = cols < 0 ? 1 : 2;
+    a->shape[0] = rows;
+    a->shape[1] = cols < 0 ? 1 : cols;
+    a->strides[0] = a->shape[1] * sizeof(int);
+    a->strides[1] = sizeof(int);
+    return (PyObject *) a;
+}
+
+
+static PyObject* py_generator_array(NyGraph *g)
+// The generators found by the search as a (no_generators, n) IntArray.
+// The block store_generator() filled is handed over, not copied.
+{
+    int *data = g->generators;
+    int i;
+
+    if (g->generators_lost) return PyErr_NoMemory();
+    if (data == NULL && (data = malloc(sizeof(int))) == NULL) {
+        return PyErr_NoMemory();
+    }
+    g->generators = NULL;
+    g->max_no_generators = 0;
+    // keep the first layer of each generator of a layered graph
+    for (i = 1; g->no_base_vertices < g->no_vertices &&
+            i < g->no_generators; i++) {
+        memmove(data + (size_t) i * g->no_base_vertices,
+                data + (size_t) i * g->no_vertices,
+                g->no_base_vertices * sizeof(int));
+    }
+    return new_int_array(data, g->no_generators, g->no_base_vertices);
+}
+
+
+static PyObject* py_int_array(int *array, int length)
+// a copy of the ints of array as a 1-dimensional IntArray
+{
+    int *data;
+
+    if ((data = malloc((length + 1) * sizeof(int))) == NULL) {
+        return PyErr_NoMemory();
+    }
+    memcpy(data, array, length * sizeof(int));
+    return new_int_array(data, length, -1);
+}
+
+
+static int count_orbits(NyGraph *g)
+// The number of orbits of the vertices given, numorbits unless the
+// graph was layered.
+{
+    int i, count = 0;
+
+    if (g->no_base_vertices == g->no_vertices) return g->stats->numorbits;
+    for (i = 0; i < g->no_base_vertices; i++) {
+        if (g->orbits[i] == i) count++;
+    }
+    return count;
+}
+
+
+static PyObject* py_auto_group(NyGraph *g, boolean as_array)
+// convert generators, orbits etc. into Python representation
+// and return it in a tuple:
+//      (generators, order, orbits, orbit_no)
+// the generators and orbits as IntArrays if as_array
+{
+    PyObject *py_autgrp;
+    PyObject *py_gens;
+    PyObject *py_orbits;
+    PyObject *py_grpsize1;
+    PyObject *py_grpsize2;
+
+    // generators
+    py_gens = as_array ? py_generator_array(g) : py_generators(g);
+    if (py_gens == NULL) return NULL;
+
+    // group order
+    //
+    // "the order of the autgrp is equal to
+    //      grpsize1 * 10^grpsize2
+    // within rounding error" -- Nauty manual
+    //
+    py_grpsize1 = Py_BuildValue("d", g->stats->grpsize1);
+    py_grpsize2 = Py_BuildValue("i", g->stats->grpsize2);
+
+    // orbits
+    py_orbits = as_array ? py_int_array(g->orbits, g->no_base_vertices)
+                         : py_int_list(g->orbits, g->no_base_vertices);
+    if (py_orbits == NULL) {
+        Py_DECREF(py_gens);
+        return NULL;
+    }
+
+    // create return value tuple:
+    //      (generators, grpsize1, grpsize2, orbits, orbit_no)
+    py_autgrp = PyTuple_New(5);
+    PyTuple_SetItem(py_autgrp, 0, py_gens);
+    PyTuple_SetItem(py_autgrp, 1, py_grpsize1);
+    PyTuple_SetItem(py_autgrp, 2, py_grpsize2);
+    PyTuple_SetItem(py_autgrp, 3, py_orbits);
+    PyTuple_SetItem(py_autgrp, 4, Py_BuildValue("i", count_orbits(g)));
+
+    return py_autgrp;
+}
+
+
+static PyObject* py_group_order(NyGraph *g)
+// the exact order of the automorphism group as a Python int, the
+// product of the level indices; None if the search ran Traces, which
+// does not report them, and the order is too large for grpsize1
+{
+    unsigned long long product = 1;
+    PyObject *order;
+    PyObject *factor;
+    PyObject *tmp;
+    int i;
+
+    if (g->mode == NY_TRACES) {
+        if (g->stats->grpsize2 == 0) {
+            return PyLong_FromDouble(floor(g->stats->grpsize1 + 0.5));
+        }
+        Py_RETURN_NONE;
+    }
+
+    if ((order = PyLong_FromLong(1)) == NULL) return NULL;
+    for (i = 0; i <= g->no_levels; i++) {
+        // multiply in machine words while the product fits
+        if (i < g->no_levels &&
+                product <= ULLONG_MAX / (unsigned) g->level_index[i]) {
+            product *= g->level_index[i];
+            continue;
+        }
+        if ((factor = PyLong_FromUnsignedLongLong(product)) == NULL) {
+            Py_DECREF(order);
+            return NULL;
+        }
+        tmp = PyNumber_Multiply(order, factor);
+        Py_DECREF(factor);
+        Py_DECREF(order);
+        if ((order = tmp) == NULL) return NULL;
+        if (i < g->no_levels) product = g->level_index[i];
+    }
+    return order;
+}
+
+
+static PyStructSequence_Field stats_fields[] = {
+    {"grpsize1", "the group order is grpsize1 * 10**grpsize2"},
+    {"grpsize2", NULL},
+    {"numorbits", "number of orbits of the group"},
+    {"numgenerators", "number of generators found"},
+    {"errstatus", "nauty's error code, 0 if none"},
+    {"numnodes", "total number of nodes of the search tree"},
+    {"numbadleaves", "number of leaves of no use"},
+    {"maxlevel", "maximum depth of the search"},
+    {"tctotal", "total size of all target cells"},
+    {"canupdates", "number of updates of the best labeling"},
+    {"invapplics", "number of applications of the vertex invariant"},
+    {"invsuccesses", "number of successful uses of the vertex invariant"},
+    {"invarsuclevel", "least level where the vertex invariant worked"},
+    {"mode", "the search engine: 'dense', 'sparse' or 'traces'"},
+    {"time", "wall clock seconds of the search"},
+    {"cpu_time", "CPU seconds of the search"},
+    {NULL}
+};
+
+static PyStructSequence_Desc stats_desc = {
+    "nautywrap.SearchStats",
+    "The statistics of a Nauty search: the fields of nauty's statsblk,\n"
+    "the engine and the time it took.",
+    stats_fields,
+    16
+};
+
+static PyTypeObject NyStatsType;
+
+
+static PyObject* py_stats(NyGraph *g)
+// the statistics of the search as a SearchStats
+{
+    static const char *modes[] = {"dense", "sparse", "traces"};
+    statsblk *st = g->stats;
+    PyObject *stats;
+    PyObject *item;
+    int i;
+
+    if ((stats = PyStructSequence_New(&NyStatsType)) == NULL) return NULL;
+    for (i = 0; i < 16; i++) {
+        switch (i) {
+        case 0: item = PyFloat_FromDouble(st->grpsize1); break;
+        case 1: item = PyLong_FromLong(st->grpsize2); break;
+        case 2: item = PyLong_FromLong(count_orbits(g)); break;
+        case 3: item = PyLong_FromLong(st->numgenerators); break;
+        case 4: item = PyLong_FromLong(st->errstatus); break;
+        case 5: item = PyLong_FromUnsignedLong(st->numnodes); break;
+        case 6: item = PyLong_FromUnsignedLong(st->numbadleaves); break;
+        case 7: item = PyLong_FromLong(st->maxlevel); break;
+        case 8: item = PyLong_FromUnsignedLong(st->tctotal); break;
+        case 9: item = PyLong_FromUnsignedLong(st->canupdates); break;
+        case 10: item = PyLong_FromUnsignedLong(st->invapplics); break;
+        case 11: item = PyLong_FromUnsignedLong(st->invsuccesses); break;
+        case 12: item = PyLong_FromLong(st->invarsuclevel); break;
+        case 13: item = PyUnicode_FromString(modes[g->mode]); break;
+        case 14: item = PyFloat_FromDouble(g->search_time); break;
+        default: item = PyFloat_FromDouble(g->search_cpu_time); break;
+        }
+        if (item == NULL) {
+            Py_DECREF(stats);
+            return NULL;
+        }
+        PyStructSequence_SET_ITEM(stats, i, item);
+    }
+    return stats;
+}
+
+
+static int compare_ints(const void *a, const void *b)
+{
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+
+static int open_int_buffer(PyObject *obj, Py_buffer *view, int ndim)
+// Get a C contiguous buffer of native 1, 2, 4 or 8 byte integers with
+// ndim dimensions.  Return -1 with a Python exception set on error.
+{
+    const char *f;
+
+    if (PyObject_GetBuffer(obj, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT)
+            < 0) {
+        return -1;
+    }
+    f = view->format != NULL ? view->format : "B";
+    if (*f == '@' || *f == '=') f++;
+    if (f[0] == '\0' || f[1] != '\0' || strchr("bBhHiIlLqQ", f[0]) == NULL ||
+            (view->itemsize != 1 && view->itemsize != 2 &&
+             view->itemsize != 4 && view->itemsize != 8)) {
+        PyErr_Format(PyExc_TypeError,
+                "arrays of integers expected, not '%s'",
+                view->format != NULL ? view->format : "B");
+        PyBuffer_Release(view);
+        return -1;
+    }
+    if (view->ndim != ndim) {
+        PyErr_Format(PyExc_ValueError,
+                "%d-dimensional array expected", ndim);
+        PyBuffer_Release(view);
+        return -1;
+    }
+    return 0;
+}
+
+
+static long long int_buffer_item(Py_buffer *view, Py_ssize_t k)
+// The k-th item of a buffer checked by open_int_buffer().  Unsigned
+// 64 bit items above LLONG_MAX are returned as LLONG_MAX, which every
+// caller rejects as too large, rather than wrapped around.
+{
+    boolean is_signed = view->format != NULL &&
+        islower(view->format[strlen(view->format) - 1]);
+    uint64_t u;
+
+    switch (view->itemsize) {
+    case 1:
+        return is_signed ? (long long) ((int8_t *) view->buf)[k]
+                         : (long long) ((uint8_t *) view->buf)[k];
+    case 2:
+        return is_signed ? (long long) ((int16_t *) view->buf)[k]
+                         : (long long) ((uint16_t *) view->buf)[k];
+    case 4:
+        return is_signed ? (long long) ((int32_t *) view->buf)[k]
+                         : (long long) ((uint32_t *) view->buf)[k];
+    }
+    if (is_signed) return (long long) ((int64_t *) view->buf)[k];
+    u = ((uint64_t *) view->buf)[k];
+    return u > (uint64_t) LLONG_MAX ? LLONG_MAX : (long long) u;
+}
+
+
+static int color_partition(const int *colors, int no_colors, int n,
+        int *lab, int *ptn)
+// Counting sort the vertices by their colors 0 .. no_colors-1 into
+// nauty's (lab, ptn) at partition level 0, a cell per color in
+// increasing order, like setlabptn() of gtnauty.c does for weights.
+// Return 1, or 0 if out of memory.
+{
+    int *end;
+    int v, i, x;
+
+    if ((end = calloc(no_colors + 1, sizeof(int))) == NULL) return 0;
+
+    for (v = 0; v < n; v++) end[colors[v]]++;
+    for (x = 1; x < no_colors; x++) end[x] += end[x-1];
+    for (v = n - 1; v >= 0; v--) lab[--end[colors[v]]] = v;
+    free(end);
+
+    for (i = 0; i < n; i++) {
+        ptn[i] = i < n - 1 && colors[lab[i]] == colors[lab[i+1]];
+    }
+    return 1;
+}
+
+
+static int read_colors(PyObject *obj, int n, int *colors)
+// Read an array of n non-negative integers, the colors of the
+// vertices, into colors renumbered 0, 1, ... in the same order.
+// Return the number of colors, -1 with a Python exception set on error.
+{
+    Py_buffer view;
+    long long x, max = -1;
+    int *rank;
+    int v, k, c;
+
+    if (open_int_buffer(obj, &view, 1) < 0) return -1;
+    if (view.shape[0] != n) {
+        PyErr_Format(PyExc_ValueError,
+                "color array of length %d expected", n);
+        PyBuffer_Release(&view);
+        return -1;
+    }
+    for (v = 0; v < n; v++) {
+        x = int_buffer_item(&view, v);
+        if (x < 0 || x > INT_MAX) {
+            PyErr_Format(PyExc_ValueError,
+                    "invalid color %lld of vertex %d", x, v);
+            PyBuffer_Release(&view);
+            return -1;
+        }
+        colors[v] = (int) x;
+        if (x > max) max = x;
+    }
+    PyBuffer_Release(&view);
+
+    if (max < n) {
+        // rank the colors used by counting
+        if ((rank = calloc(max + 2, sizeof(int))) == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        for (v = 0; v < n; v++) rank[colors[v]] = 1;
+        for (c = k = 0; c <= max; c++) {
+            x = rank[c];
+            rank[c] = k;
+            k += x;
+        }
+    } else {
+        // rank them by sorting, there are fewer colors than their range
+        if ((rank = malloc((n + 1) * sizeof(int))) == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        memcpy(rank, colors, n * sizeof(int));
+        qsort(rank, n, sizeof(int), compare_ints);
+        for (v = k = 0; v < n; v++) {
+            if (v == 0 || rank[v] != rank[v-1]) rank[k++] = rank[v];
+        }
+        for (v = 0; v < n; v++) {
+            colors[v] = (int *) bsearch(colors + v, rank, k, sizeof(int),
+                    compare_ints) - rank;
+        }
+        free(rank);
+        return k;
+    }
+    for (v = 0; v < n; v++) colors[v] = rank[colors[v]];
+    free(rank);
+    return k;
+}
+
+
+static int set_partition(PyObject *py_graph, int n, int *lab, int *ptn)
+// Convert the vertex_coloring attribute of a NyGraph object, or its
+// per-vertex color array if it has one, into nauty (lab, ptn) data
+// structure at partition level 0
+{
+    PyObject *colors;
+    PyObject *partition;
+    PyObject *pyset;
+    PyObject *iterator;
+    PyObject *item;
+    int *array;
+    int no_parts;
+    int i;
+    int k;
+    int x;
+
+    if ((colors = PyObject_GetAttrString(py_graph, "_color_array")) == NULL) {
+        PyErr_Clear();
+    } else if (colors == Py_None) {
+        Py_DECREF(colors);
+    } else {
+        if ((array = malloc((n + 1) * sizeof(int))) == NULL) {
+            Py_DECREF(colors);
+            PyErr_NoMemory();
+            return 0;
+        }
+        x = read_colors(colors, n, array);
+        Py_DECREF(colors);
+        if (x >= 2 && color_partition(array, x, n, lab, ptn) == 0) {
+            PyErr_NoMemory();
+            x = -1;
+        }
+        free(array);
+        if (x < 0) return 0;        // error
+        return x < 2 ? -1 : 1;      // no coloring or coloring
+    }
+
+    if ( !(partition = PyObject_GetAttrString(py_graph, "vertex_coloring")) ) {
+        PyErr_SetString(PyExc_TypeError,
+                "missing 'vertex_coloring' attribute");
+        return 0;       // error
+    }
+
+    if ((no_parts = PyObject_Length(partition)) <= 0) {
+        Py_DECREF(partition);
+        return -1;      // no coloring
+    }
+
+    for (i = k = 0; i < no_parts; i++) {
+        pyset = PyList_GET_ITEM(partition, i);
+        iterator = PyObject_GetIter(pyset);
+        
+        while ((item = PyIter_Next(iterator))) {
+#if PY_MAJOR_VERSION >= 3
+            x = PyLong_AS_LONG(item);
+#else
+            x = PyInt_AS_LONG(item);
+#endif
+            Py_DECREF(item);
+            lab[k] = x;
+            ptn[k++] = 1;
+        }
+        if (k > 0) {
+            ptn[k-1] = 0;
+        }
+
+        Py_DECREF(iterator);
+    }
+
+    Py_DECREF(partition);
+
+    return 1;           // coloring
+}
+
+
+static int read_edge_array(PyObject *edges, long n, int **pairs,
+        size_t *no_pairs, size_t extra)
+// Read an (E, 2) array of edges, or an (indptr, indices) pair of
+// arrays in compressed sparse row format, into a newly allocated array
+// of (tail, head) pairs followed by room for extra more ints.
+// Return -1 with a Python exception set on error.
+{
+    Py_buffer a, b;
+    Py_ssize_t k, e;
+    long long x, y;
+    boolean csr;
+
+    csr = PyTuple_Check(edges) && PyTuple_GET_SIZE(edges) == 2;
+    if (open_int_buffer(csr ? PyTuple_GET_ITEM(edges, 0) : edges,
+                &a, csr ? 1 : 2) < 0) {
+        return -1;
+    }
+    if (csr) {
+        if (open_int_buffer(PyTuple_GET_ITEM(edges, 1), &b, 1) < 0) {
+            PyBuffer_Release(&a);
+            return -1;
+        }
+        if (a.shape[0] != n + 1) {
+            PyErr_SetString(PyExc_ValueError,
+                    "indptr must have number_of_vertices + 1 items");
+            goto fail;
+        }
+        *no_pairs = b.shape[0];
+    } else {
+        if (a.shape[1] != 2) {
+            PyErr_SetString(PyExc_ValueError,
+                    "edge array of shape (E, 2) expected");
+            PyBuffer_Release(&a);
+            return -1;
+        }
+        *no_pairs = a.shape[0];
+    }
+
+    if (csr) {
+        for (x = 0; x < n; x++) {
+            if (int_buffer_item(&a, x + 1) < int_buffer_item(&a, x)) break;
+        }
+        if (x < n || int_buffer_item(&a, 0) != 0 ||
+                int_buffer_item(&a, n) != (long long) *no_pairs) {
+            PyErr_SetString(PyExc_ValueError, "invalid indptr array");
+            goto fail;
+        }
+    }
+
+    if ((*pairs = malloc((2 * *no_pairs + extra + 1) * sizeof(int)))
+            == NULL) {
+        PyErr_NoMemory();
+        goto fail;
+    }
+    for (k = e = 0, x = 0; k < (Py_ssize_t) *no_pairs; k++) {
+        if (csr) {
+            // the tail is the row whose indptr range holds k
+            while (int_buffer_item(&a, x + 1) <= k) x++;
+            y = int_buffer_item(&b, k);
+        } else {
+            x = int_buffer_item(&a, 2*k);
+            y = int_buffer_item(&a, 2*k+1);
+        }
+        if (x < 0 || x >= n || y < 0 || y >= n) {
+            PyErr_Format(PyExc_ValueError,
+                    "edge (%lld, %lld) conflicts with "
+                    "number_of_vertices=%ld", x, y, n);
+            free(*pairs);
+            goto fail;
+        }
+        (*pairs)[e++] = x;
+        (*pairs)[e++] = y;
+    }
+
+    PyBuffer_Release(&a);
+    if (csr) PyBuffer_Release(&b);
+    return 0;
+
+fail:
+    PyBuffer_Release(&a);
+    if (csr) PyBuffer_Release(&b);
+    return -1;
+}
+
+
+static PyObject* get_edge_array(PyObject *py_graph)
+// The _edge_array attribute of a Graph built by from_edge_array(),
+// NULL without an exception set if there is none.
+{
+    PyObject *edges;
+
+    if ((edges = PyObject_GetAttrString(py_graph, "_edge_array")) == NULL) {
+        PyErr_Clear();
+        return NULL;
+    }
+    if (edges == Py_None) {
+        Py_DECREF(edges);
+        return NULL;
+    }
+    return edges;
+}
+
+
+static int sparse_from_pairs(NyGraph *g, int *pairs, size_t no_pairs)
+// Set the sparsegraph of g from the (tail, head) pairs of its edges,
+// which must be valid vertices.  The neighbours of each vertex are
+// sorted and duplicates removed.
+// Return -1 with a Python exception set on error.
+{
+    sparsegraph *sg = &g->sg;
+    size_t nde, k, j, w;
+    long n = g->no_vertices, i, x, y;
+    int *e;
+
+    // bucket the heads by tail, in both directions if undirected
+    nde = g->options->digraph ? no_pairs : 2 * no_pairs;
+    if (nde + 1 > sg->elen) {
+        if ((e = realloc(sg->e, (nde + 1) * sizeof(int))) == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        sg->e = e;
+        sg->elen = nde + 1;
+    }
+    for (i = 0; i < n; i++) sg->d[i] = 0;
+    for (k = 0; k < no_pairs; k++) {
+        sg->d[pairs[2*k]]++;
+        if (!g->options->digraph) sg->d[pairs[2*k+1]]++;
+    }
+    for (i = 0, w = 0; i < n; i++) {
+        sg->v[i] = w;
+        w += sg->d[i];
+        sg->d[i] = 0;
+    }
+    for (k = 0; k < no_pairs; k++) {
+        x = pairs[2*k];
+        y = pairs[2*k+1];
+        sg->e[sg->v[x] + sg->d[x]++] = y;
+        if (!g->options->digraph) sg->e[sg->v[y] + sg->d[y]++] = x;
+    }
+
+    // sort the neighbour lists and drop duplicates, compacting e
+    for (i = 0, w = 0; i < n; i++) {
+        e = sg->e + sg->v[i];
+        qsort(e, sg->d[i], sizeof(int), compare_ints);
+        sg->v[i] = w;
+        for (j = 0; j < (size_t) sg->d[i]; j++) {
+            if (j == 0 || e[j] != e[j-1]) sg->e[w++] = e[j];
+        }
+        sg->d[i] = w - sg->v[i];
+    }
+    sg->nv = n;
+    sg->nde = w;
+
+    return 0;
+}
+
+
+static int fill_edge_array(NyGraph *g, PyObject *edges)
+// Set the graph of g, of any mode, from an edge array as accepted by
+// read_edge_array().  Return -1 with a Python exception set on error.
+{
+    int *pairs;
+    size_t no_pairs, k;
+    int ret = 0;
+
+    if (read_edge_array(edges, g->no_vertices, &pairs, &no_pairs, 0) < 0) {
+        return -1;
+    }
+    if (g->mode == NY_DENSE) {
+        for (k = 0; k < no_pairs; k++) {
+            make_edge(g, pairs[2*k], pairs[2*k+1]);
+        }
+    } else {
+        ret = sparse_from_pairs(g, pairs, no_pairs);
+    }
+    free(pairs);
+    return ret;
+}
+
+
+static int collect_pairs(PyObject *adjdict, long n, int **pairs_p,
+        size_t *no_pairs_p)
+// Read an adjacency list dictionary of a graph on n vertices into a
+// newly allocated array of (tail, head) pairs.
+// Return -1 with a Python exception set on error.
+{
+    PyObject *key;
+    PyObject *adjlist;
+    PyObject *seq;
+    Py_ssize_t pos, i, len;
+    size_t no_pairs, k;
+    long x, y;
+    int *pairs;
+
+    // collect the (tail, head) pairs
+    pos = 0;
+    no_pairs = 0;
+    while (PyDict_Next(adjdict, &pos, &key, &adjlist)) {
+        if ((len = PyObject_Length(adjlist)) < 0) return -1;
+        no_pairs += len;
+    }
+    if ((pairs = malloc((2 * no_pairs + 1) * sizeof(int))) == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    pos = 0;
+    k = 0;
+    while (PyDict_Next(adjdict, &pos, &key, &adjlist)) {
+        x = PyLong_AsLong(key);
+        if (x == -1 && PyErr_Occurred()) goto fail;
+        if ((seq = PySequence_Fast(adjlist, "adjacency list expected"))
+                == NULL) {
+            goto fail;
+        }
+        len = PySequence_Fast_GET_SIZE(seq);
+        for (i = 0; i < len && k < no_pairs; i++, k++) {
+            y = PyLong_AsLong(PySequence_Fast_GET_ITEM(seq, i));
+            if (y == -1 && PyErr_Occurred()) {
+                Py_DECREF(seq);
+                goto fail;
+            }
+            if (x < 0 || x >= n || y < 0 || y >= n) {
+                PyErr_Format(PyExc_ValueError,
+                        "edge (%ld, %ld) conflicts with "
+                        "number_of_vertices=%ld", x, y, n);
+                Py_DECREF(seq);
+                goto fail;
+            }
+            pairs[2*k] = x;
+            pairs[2*k+1] = y;
+        }
+        Py_DECREF(seq);
+    }
+    *pairs_p = pairs;
+    *no_pairs_p = k;
+    return 0;
+
+fail:
+    free(pairs);
+    return -1;
+}
+
+
+static int fill_sparse(NyGraph *g, PyObject *adjdict)
+// Set the sparsegraph of g from an adjacency list dictionary.
+// Return -1 with a Python exception set on error.
+{
+    int *pairs;
+    size_t no_pairs;
+    int ret;
+
+    if (collect_pairs(adjdict, g->no_vertices, &pairs, &no_pairs) < 0) {
+        return -1;
+    }
+    ret = sparse_from_pairs(g, pairs, no_pairs);
+    free(pairs);
+    return ret;
+}
+
+
+static boolean degrees_equitable(NyGraph *g)
+// Are the vertices of each cell of the level 0 partition of the
+// sparsegraph of g of the same degree?  Then refinement alone does not
+// split the cells, which is the case where Traces outperforms nauty.
+{
+    int i, first;
+
+    for (i = first = 0; i < g->no_vertices; i++) {
+        if (g->options->defaultptn) {
+            if (g->sg.d[i] != g->sg.d[0]) return FALSE;
+        } else {
+            if (g->sg.d[g->lab[i]] != g->sg.d[g->lab[first]]) return FALSE;
+            if (g->ptn[i] == 0) first = i + 1;
+        }
+    }
+    return TRUE;
+}
+
+
+static int choose_mode(NyGraph *g)
+// The search engine for the sparsegraph of g under the 'auto' policy.
+// The choice depends on isomorphism invariants only, so isomorphic
+// graphs get the same engine and their certificates stay comparable.
+// The thresholds were calibrated with benchmarks/engines.py.
+{
+    int n = g->no_vertices;
+    boolean large, thin;
+
+    if (n <= AUTO_SMALL_VERTICES) return NY_DENSE;
+
+    // a bit matrix would be too big, or a refinement on it too slow
+    large = n > AUTO_DENSE_MAX_VERTICES;
+    thin = n > AUTO_THIN_MIN_VERTICES &&
+        g->sg.nde < (size_t) AUTO_THIN_MAX_DEGREE * n;
+
+    if (g->options->digraph) {
+        // Traces does not support directed graphs
+        return large || thin ? NY_SPARSE : NY_DENSE;
+    }
+    return large || thin || degrees_equitable(g) ? NY_TRACES : NY_DENSE;
+}
+
+
+static NyGraph * settle_mode(NyGraph *g)
+// Hand the sparsegraph g, including its coloring, to the engine picked
+// by choose_mode().  Return the NyGraph to use, which may be a new
+// dense one, or NULL if that cannot be allocated.
+{
+    NyGraph *d;
+    set *rowp;
+    int i;
+    size_t k;
+
+    g->mode = choose_mode(g);
+    if (g->mode != NY_DENSE) return g;
+
+    g->mode = NY_SPARSE;
+    if ((d = acquire_nygraph(g->no_vertices, NY_DENSE)) == NULL) {
+        release_nygraph(g);
+        return NULL;
+    }
+    // the sparsegraph is already symmetric for undirected graphs
+    for (i = 0; i < g->no_vertices; i++) {
+        rowp = GRAPHROW(d->matrix, i, d->no_setwords);
+        for (k = g->sg.v[i]; k < g->sg.v[i] + g->sg.d[i]; k++) {
+            ADDELEMENT(rowp, g->sg.e[k]);
+        }
+    }
+    d->options->digraph = g->options->digraph;
+    d->options->defaultptn = g->options->defaultptn;
+    if (!g->options->defaultptn) {
+        memcpy(d->lab, g->lab, g->no_vertices * sizeof(int));
+        memcpy(d->ptn, g->ptn, g->no_vertices * sizeof(int));
+    }
+    d->no_base_vertices = g->no_base_vertices;
+    release_nygraph(g);
+    return d;
+}
+
+
+static int compare_arcs(const void *a, const void *b)
+// order (tail, head, ...) int tuples by tail, then head
+{
+    const int *x = a, *y = b;
+
+    if (x[0] != y[0]) return x[0] < y[0] ? -1 : 1;
+    if (x[1] != y[1]) return x[1] < y[1] ? -1 : 1;
+    return 0;
+}
+
+
+static int read_edge_colors(PyObject *py_graph, int n, boolean digraph,
+        int **arcs_p, size_t *no_arcs_p)
+// Read the _edge_colors dictionary of py_graph, mapping (x, y) to a
+// positive int, into *arcs_p as (tail, head, color) triples sorted by
+// tail and head; x <= y if undirected.  Return the largest color, 0 if
+// there are none, or -1 with a Python exception set.
+{
+    PyObject *colors, *key, *value;
+    Py_ssize_t pos = 0;
+    int *arcs, *a;
+    size_t no_arcs = 0, k;
+    long x, y, c;
+    int max_color = 0;
+
+    *arcs_p = NULL;
+    *no_arcs_p = 0;
+    if ((colors = PyObject_GetAttrString(py_graph, "_edge_colors")) == NULL) {
+        // not a Graph, or one without edge colors
+        PyErr_Clear();
+        return 0;
+    }
+    if (!PyDict_Check(colors) || PyDict_Size(colors) == 0) {
+        Py_DECREF(colors);
+        return 0;
+    }
+    if ((arcs = malloc(3 * PyDict_Size(colors) * sizeof(int))) == NULL) {
+        Py_DECREF(colors);
+        PyErr_NoMemory();
+        return -1;
+    }
+    while (PyDict_Next(colors, &pos, &key, &value)) {
+        if (!PyTuple_Check(key) || PyTuple_GET_SIZE(key) != 2 ||
+                (x = PyLong_AsLong(PyTuple_GET_ITEM(key, 0))) == -1 ||
+                (y = PyLong_AsLong(PyTuple_GET_ITEM(key, 1))) == -1 ||
+                x < 0 || x >= n || y < 0 || y >= n) {
+            PyErr_Clear();
+            PyErr_SetString(PyExc_ValueError,
+                    "edge_colors must be keyed by edges (x, y)");
+            goto failed;
+        }
+        c = PyLong_AsLong(value);
+        if (c < 1 || c > INT_MAX) {
+            PyErr_Clear();
+            PyErr_SetString(PyExc_ValueError,
+                    "edge colors must be positive ints");
+            goto failed;
+        }
+        a = arcs + 3 * no_arcs++;
+        a[0] = digraph || x <= y ? x : y;
+        a[1] = digraph || x <= y ? y : x;
+        a[2] = c;
+        if (c > max_color) max_color = c;
+    }
+    Py_DECREF(colors);
+
+    qsort(arcs, no_arcs, 3 * sizeof(int), compare_arcs);
+    for (k = 1; k < no_arcs; k++) {
+        if (compare_arcs(arcs + 3*k, arcs + 3*(k-1)) == 0 &&
+                arcs[3*k+2] != arcs[3*k-1]) {
+            PyErr_Format(PyExc_ValueError,
+                    "edge (%d, %d) has two colors", arcs[3*k], arcs[3*k+1]);
+            free(arcs);
+            return -1;
+        }
+    }
+    *arcs_p = arcs;
+    *no_arcs_p = no_arcs;
+    return max_color;
+
+failed:
+    Py_DECREF(colors);
+    free(arcs);
+    return -1;
+}
+
+
+static NyGraph * layer_nygraph(NyGraph *g, int *colored, size_t no_colored,
+        int max_color)
+// Encode the edge colors of g in layers, as in section 14 of the nauty
+// guide: each color is a binary number of L digits, the bit length of
+// max_color; vertex v of g has copies v + i*n in layers i = 0..L-1,
+// joined by a path, and layer i has the edges whose color has bit i
+// set.  The edges of g have color 1 unless they are among the sorted
+// (tail, head, color) triples of colored, which may add edges.  Layer
+// i takes the vertex coloring of g in cells of its own, after those of
+// layer i-1, so the canonical labeling and the orbits of g are those
+// of layer 0.  Return the layered NyGraph of the same mode, or NULL
+// with a Python exception set; g is released.
+{
+    NyGraph *h;
+    int *arcs, *pairs, *a;
+    size_t no_arcs = 0, no_pairs = 0, k, w;
+    int n = g->no_vertices, no_layers, i, v, x;
+    set *rowp;
+
+    for (no_layers = 0; max_color >> no_layers; no_layers++);
+    if (n > INT_MAX / 2 / no_layers) {
+        PyErr_SetString(PyExc_ValueError, "too many vertices to layer");
+        release_nygraph(g);
+        return NULL;
+    }
+
+    // the edges of g, x <= y if undirected, with color 0 for "plain",
+    // then the colored ones, which win over plain ones once sorted
+    if (g->mode == NY_DENSE) {
+        for (v = 0; v < n; v++) {
+            rowp = GRAPHROW(g->matrix, v, g->no_setwords);
+            for (x = -1; (x = nextelement(rowp, g->no_setwords, x)) >= 0;) {
+                no_arcs++;
+            }
+        }
+    } else {
+        no_arcs = g->sg.nde;
+    }
+    if ((arcs = malloc(3 * (no_arcs + no_colored + 1) * sizeof(int)))
+            == NULL) {
+        PyErr_NoMemory();
+        release_nygraph(g);
+        return NULL;
+    }
+    for (v = 0, no_arcs = 0; v < n; v++) {
+        if (g->mode == NY_DENSE) {
+            rowp = GRAPHROW(g->matrix, v, g->no_setwords);
+            for (x = -1; (x = nextelement(rowp, g->no_setwords, x)) >= 0;) {
+                if (!g->options->digraph && x < v) continue;
+                a = arcs + 3 * no_arcs++;
+                a[0] = v; a[1] = x; a[2] = 0;
+            }
+        } else {
+            for (k = g->sg.v[v]; k < g->sg.v[v] + g->sg.d[v]; k++) {
+                x = g->sg.e[k];
+                if (!g->options->digraph && x < v) continue;
+                a = arcs + 3 * no_arcs++;
+                a[0] = v; a[1] = x; a[2] = 0;
+            }
+        }
+    }
+    memcpy(arcs + 3 * no_arcs, colored, 3 * no_colored * sizeof(int));
+    no_arcs += no_colored;
+    qsort(arcs, no_arcs, 3 * sizeof(int), compare_arcs);
+    for (k = 0, w = 0; k < no_arcs; k++) {
+        if (w > 0 && compare_arcs(arcs + 3*k, arcs + 3*(w-1)) == 0) {
+            if (arcs[3*k+2] > arcs[3*w-1]) arcs[3*w-1] = arcs[3*k+2];
+            continue;
+        }
+        memcpy(arcs + 3*w++, arcs + 3*k, 3 * sizeof(int));
+    }
+    no_arcs = w;
+
+    if ((h = acquire_nygraph(n * no_layers, g->mode)) == NULL ||
+            (pairs = malloc(2 * (no_arcs * no_layers +
+                    2 * (size_t) n * no_layers + 1) * sizeof(int))) == NULL) {
+        if (h != NULL) release_nygraph(h);
+        free(arcs);
+        release_nygraph(g);
+        PyErr_SetString(PyExc_MemoryError, "Nauty NyGraph creation failed");
+        return NULL;
+    }
+    h->options->digraph = g->options->digraph;
+    for (k = 0; k < no_arcs; k++) {
+        a = arcs + 3*k;
+        for (i = 0; i < no_layers; i++) {
+            if ((a[2] == 0 ? 1 : a[2]) & (1 << i)) {
+                pairs[2*no_pairs] = a[0] + i * n;
+                pairs[2*no_pairs+1] = a[1] + i * n;
+                no_pairs++;
+            }
+        }
+    }
+    free(arcs);
+    // the paths between the layers, both ways in digraphs
+    for (i = 0; i + 1 < no_layers; i++) {
+        for (v = 0; v < n; v++) {
+            pairs[2*no_pairs] = v + i * n;
+            pairs[2*no_pairs+1] = v + (i + 1) * n;
+            no_pairs++;
+            if (h->options->digraph) {
+                pairs[2*no_pairs] = v + (i + 1) * n;
+                pairs[2*no_pairs+1] = v + i * n;
+                no_pairs++;
+            }
+        }
+    }
+    if (h->mode == NY_DENSE) {
+        for (k = 0; k < no_pairs; k++) make_edge(h, pairs[2*k], pairs[2*k+1]);
+    } else if (sparse_from_pairs(h, pairs, no_pairs) < 0) {
+        free(pairs);
+        release_nygraph(h);
+        release_nygraph(g);
+        return NULL;
+    }
+    free(pairs);
+
+    // the coloring of g repeated in each layer
+    for (i = 0; i < no_layers; i++) {
+        for (v = 0; v < n; v++) {
+            h->lab[i*n + v] = (g->options->defaultptn ? v : g->lab[v]) + i*n;
+            h->ptn[i*n + v] = g->options->defaultptn ?
+                (v < n - 1 ? 1 : 0) : g->ptn[v];
+        }
+    }
+    h->options->defaultptn = no_layers == 1 ? g->options->defaultptn : FALSE;
+    h->no_base_vertices = n;
+    release_nygraph(g);
+    return h;
+}
+
+
+static int parse_mode(const char *name)
+// Map the name of a search engine to its NY_* constant, -1 if unknown.
+{
+    if (strcmp(name, "dense") == 0) return NY_DENSE;
+    if (strcmp(name, "sparse") == 0) return NY_SPARSE;
+    if (strcmp(name, "traces") == 0) return NY_TRACES;
+    if (strcmp(name, "auto") == 0) return NY_AUTO;
+    return -1;
+}
+
+
+static int parse_format(const char *name)
+// The NY_CERT_* constant of a certificate format name, -1 if unknown.
+{
+    if (strcmp(name, "raw") == 0) return NY_CERT_RAW;
+    if (strcmp(name, "edges") == 0) return NY_CERT_EDGES;
+    if (strcmp(name, "sparse6") == 0) return NY_CERT_SPARSE6;
+    if (strcmp(name, "hash128") == 0) return NY_CERT_HASH128;
+    if (strcmp(name, "hash256") == 0) return NY_CERT_HASH256;
+    return -1;
+}
+
+
+// the vertex invariants of nautinv.c by name, with the version for
+// sparse graphs where nausparse.c has one, as in dreadnaut
+static const struct {
+    const char *name;
+    void (*dense)(graph*, int*, int*, int, int, int, int*, int, boolean,
+            int, int);
+    void (*sparse)(graph*, int*, int*, int, int, int, int*, int, boolean,
+            int, int);
+} INVARIANTS[] = {
+    {"twopaths", twopaths, NULL},
+    {"adjtriang", adjtriang, NULL},
+    {"triples", triples, NULL},
+    {"quadruples", quadruples, NULL},
+    {"celltrips", celltrips, NULL},
+    {"cellquads", cellquads, NULL},
+    {"cellquins", cellquins, NULL},
+    {"distances", distances, distances_sg},
+    {"indsets", indsets, NULL},
+    {"cliques", cliques, NULL},
+    {"cellcliq", cellcliq, NULL},
+    {"cellind", cellind, NULL},
+    {"adjacencies", adjacencies, adjacencies_sg},
+    {"cellfano", cellfano, NULL},
+    {"cellfano2", cellfano2, NULL},
+    {"refinvar", refinvar, NULL},
+    {NULL, NULL, NULL},
+};
+
+
+static int set_invariant(NyGraph *g, const char *name, int invararg,
+        int mininvarlevel, int maxinvarlevel)
+// Have nauty apply the named vertex invariant when searching g, none
+// if name is NULL.  Return -1 with a Python exception if there is no
+// such invariant for the search engine of g.
+{
+    int i;
+
+    if (name == NULL) return 0;
+    for (i = 0; INVARIANTS[i].name != NULL; i++) {
+        if (strcmp(name, INVARIANTS[i].name) == 0) break;
+    }
+    if (INVARIANTS[i].name == NULL) {
+        PyErr_Format(PyExc_ValueError, "unknown invariant '%s'", name);
+        return -1;
+    }
+    if (g->mode == NY_TRACES) {
+        PyErr_SetString(PyExc_ValueError,
+                "Traces does not use vertex invariants");
+        return -1;
+    }
+    if (g->mode == NY_SPARSE && INVARIANTS[i].sparse == NULL) {
+        PyErr_Format(PyExc_ValueError,
+                "invariant '%s' needs mode='dense'", name);
+        return -1;
+    }
+    g->options->invarproc = g->mode == NY_DENSE ?
+        INVARIANTS[i].dense : INVARIANTS[i].sparse;
+    g->options->invararg = invararg;
+    g->options->mininvarlevel = mininvarlevel;
+    g->options->maxinvarlevel = maxinvarlevel;
+    return 0;
+}
+
+
+static int set_refinement(NyGraph *g, int tc_level, PyObject *refine)
+// Set the target cell level of the search of g, unless negative, and
+// its refinement procedure, unless refine is None: "refine" or
+// "refine1" of naugraph.c, or a function in a capsule named
+// "pynauty.userrefproc".  Return -1 with a Python exception if the
+// search engine of g cannot take them.
+{
+    void (*proc)(graph*, int*, int*, int, int*, int*, set*, int*, int, int);
+    const char *name;
+
+    if (tc_level < 0 && refine == Py_None) return 0;
+    if (g->mode == NY_TRACES) {
+        PyErr_SetString(PyExc_ValueError,
+                "Traces does not use tc_level or refine");
+        return -1;
+    }
+    if (tc_level >= 0) g->options->tc_level = tc_level;
+    if (refine == Py_None) return 0;
+
+    if (PyCapsule_CheckExact(refine)) {
+        proc = PyCapsule_GetPointer(refine, "pynauty.userrefproc");
+        if (proc == NULL) return -1;
+    } else if ((name = PyUnicode_AsUTF8(refine)) == NULL) {
+        PyErr_Clear();
+        PyErr_SetString(PyExc_TypeError,
+                "refine must be a name or a capsule");
+        return -1;
+    } else if (strcmp(name, "refine") == 0) {
+        // nauty's default for the engine
+        return 0;
+    } else if (strcmp(name, "refine1") == 0) {
+        if (g->mode != NY_DENSE || g->no_setwords != 1) {
+            PyErr_Format(PyExc_ValueError,
+                    "refine1 needs mode='dense' and at most %d vertices",
+                    WORDSIZE);
+            return -1;
+        }
+        proc = refine1;
+    } else {
+        PyErr_Format(PyExc_ValueError,
+                "unknown refinement procedure '%s'", name);
+        return -1;
+    }
+    g->options->userrefproc = proc;
+    return 0;
+}
+
+
+static PyObject* hash_certificate(graph *cg, sparsegraph *csg,
+        int m, int n, int format)
+// Concatenate hashgraph() values of the canonical graph, cg if it is
+// not NULL and csg otherwise, under different keys.  Each 31 bit value
+// is stored big-endian in 4 bytes so the result is machine independent.
+{
+    static const long keys[8] = {
+        0x2C31A1BBL, 0x5B7E03C5L, 0x1F0D6E8FL, 0x6A2B9D17L,
+        0x3E94C2A9L, 0x71D5F04BL, 0x0E6B37D3L, 0x4F8A5C61L,
+    };
+    unsigned char digest[32];
+    unsigned long h;
+    int i, no_keys;
+
+    no_keys = format == NY_CERT_HASH128 ? 4 : 8;
+    for (i = 0; i < no_keys; i++) {
+        h = cg != NULL ? hashgraph(cg, m, n, keys[i])
+                       : hashgraph_sg(csg, keys[i]);
+        digest[4*i] = (h >> 24) & 0xFF;
+        digest[4*i+1] = (h >> 16) & 0xFF;
+        digest[4*i+2] = (h >> 8) & 0xFF;
+        digest[4*i+3] = h & 0xFF;
+    }
+    return PyBytes_FromStringAndSize((char *) digest, 4 * no_keys);
+}
+
+
+static PyObject* text_certificate(char *s)
+// A gtools string without its trailing newline as a bytes object.
+{
+    size_t len = strlen(s);
+
+    if (len > 0 && s[len-1] == '\n') len--;
+    return PyBytes_FromStringAndSize(s, len);
+}
+
+
+static PyObject* dense_certificate(graph *cg, int m, int n,
+        boolean digraph, int format)
+// Serialize the canonical graph cg in the given format.  The edges are
+// listed as pairs of native ints; (i, j) with i <= j only, for
+// undirected graphs.
+{
+    PyObject *pyret;
+    size_t no_edges = 0;
+    set *rowp;
+    int *p;
+    int i, j;
+
+    switch (format) {
+    case NY_CERT_EDGES:
+        for (i = 0; i < n; i++) {
+            rowp = GRAPHROW(cg, i, m);
+            j = digraph ? -1 : i - 1;
+            while ((j = nextelement(rowp, m, j)) >= 0) no_edges++;
+        }
+        pyret = PyBytes_FromStringAndSize(NULL, 2 * no_edges * sizeof(int));
+        if (pyret == NULL) return NULL;
+        p = (int *) PyBytes_AS_STRING(pyret);
+        for (i = 0; i < n; i++) {
+            rowp = GRAPHROW(cg, i, m);
+            j = digraph ? -1 : i - 1;
+            while ((j = nextelement(rowp, m, j)) >= 0) {
+                *p++ = i;
+                *p++ = j;
+            }
+        }
+        return pyret;
+    case NY_CERT_SPARSE6:
+        return text_certificate(digraph ? ntod6(cg, m, n) : ntos6(cg, m, n));
+    case NY_CERT_HASH128:
+    case NY_CERT_HASH256:
+        return hash_certificate(cg, NULL, m, n, format);
+    default:
+        return PyBytes_FromStringAndSize((char *) cg,
+                (Py_ssize_t) n * m * sizeof(setword));
+    }
+}
+
+
+static PyObject* sparse_certificate(NyGraph *g, int format)
+// Serialize the canonical sparsegraph of g in the given format.  The
+// raw format is the degrees of the vertices followed by their sorted
+// neighbour lists; the others are as for dense_certificate().
+{
+    PyObject *pyret;
+    sparsegraph *csg = &g->csg;
+    size_t no_edges, k;
+    int *p;
+    int i;
+
+    sortlists_sg(csg);
+    switch (format) {
+    case NY_CERT_EDGES:
+        no_edges = 0;
+        for (i = 0; i < g->no_vertices; i++) {
+            for (k = csg->v[i]; k < csg->v[i] + csg->d[i]; k++) {
+                if (g->options->digraph || csg->e[k] >= i) no_edges++;
+            }
+        }
+        pyret = PyBytes_FromStringAndSize(NULL, 2 * no_edges * sizeof(int));
+        if (pyret == NULL) return NULL;
+        p = (int *) PyBytes_AS_STRING(pyret);
+        for (i = 0; i < g->no_vertices; i++) {
+            for (k = csg->v[i]; k < csg->v[i] + csg->d[i]; k++) {
+                if (g->options->digraph || csg->e[k] >= i) {
+                    *p++ = i;
+                    *p++ = csg->e[k];
+                }
+            }
+        }
+        return pyret;
+    case NY_CERT_SPARSE6:
+        return text_certificate(g->options->digraph ? sgtod6(csg)
+                                                    : sgtos6(csg));
+    case NY_CERT_HASH128:
+    case NY_CERT_HASH256:
+        return hash_certificate(NULL, csg, 0, g->no_vertices, format);
+    default:
+        break;
+    }
+
+    pyret = PyBytes_FromStringAndSize(NULL,
+            (g->no_vertices + csg->nde) * sizeof(int));
+    if (pyret == NULL) return NULL;
+
+    p = (int *) PyBytes_AS_STRING(pyret);
+    memcpy(p, csg->d, g->no_vertices * sizeof(int));
+    p += g->no_vertices;
+    for (i = 0; i < g->no_vertices; i++) {
+        memcpy(p, csg->e + csg->v[i], csg->d[i] * sizeof(int));
+        p += csg->d[i];
+    }
+    return pyret;
+}
+
+
+// Compact graph type ---------------------------------------------------------
+
+static PyTypeObject NyCompactType;
+
+
+static int compact_from_pairs(NyCompact *c, int *pairs, size_t no_pairs)
+// Replace the adjacency lists of c by those of the (tail, head) pairs,
+// which must be valid vertices, sorting them and dropping duplicates.
+// Return -1 with a Python exception set on error.
+{
+    int n = c->no_vertices;
+    int *block, *indptr, *heads, *fill, *row;
+    size_t k, w;
+    int i, j;
+
+    if (no_pairs > INT_MAX) {
+        PyErr_SetString(PyExc_ValueError, "too many edges");
+        return -1;
+    }
+    block = malloc((n + 1 + no_pairs + 1) * sizeof(int));
+    fill = malloc((n + 1) * sizeof(int));
+    if (block == NULL || fill == NULL) {
+        free(block);
+        free(fill);
+        PyErr_NoMemory();
+        return -1;
+    }
+    indptr = block;
+    heads = block + n + 1;
+
+    // bucket the heads by tail
+    memset(indptr, 0, (n + 1) * sizeof(int));
+    for (k = 0; k < no_pairs; k++) indptr[pairs[2*k] + 1]++;
+    for (i = 0; i < n; i++) indptr[i+1] += indptr[i];
+    memcpy(fill, indptr, (n + 1) * sizeof(int));
+    for (k = 0; k < no_pairs; k++) heads[fill[pairs[2*k]]++] = pairs[2*k+1];
+    free(fill);
+
+    // sort the lists and drop duplicates, compacting heads
+    for (i = 0, w = 0; i < n; i++) {
+        row = heads + indptr[i];
+        qsort(row, indptr[i+1] - indptr[i], sizeof(int), compare_ints);
+        for (j = 0; j < indptr[i+1] - indptr[i]; j++) {
+            if (j == 0 || row[j] != row[j-1]) heads[w++] = row[j];
+        }
+        indptr[i+1] = w;
+    }
+    if (w < no_pairs && (row = realloc(block,
+                    (n + 1 + w + 1) * sizeof(int))) != NULL) {
+        block = row;
+    }
+
+    free(c->indptr);
+    c->indptr = block;
+    c->heads = block + n + 1;
+    return 0;
+}
+
+
+static int * compact_pairs(NyCompact *c, size_t extra)
+// A newly allocated array of the (tail, head) pairs of the arcs of c
+// followed by room for extra more ints, NULL if out of memory.
+{
+    int *pairs;
+    int v, k;
+
+    pairs = malloc((2 * (size_t) c->indptr[c->no_vertices] + extra + 1) *
+            sizeof(int));
+    if (pairs == NULL) return NULL;
+    for (v = 0; v < c->no_vertices; v++) {
+        for (k = c->indptr[v]; k < c->indptr[v+1]; k++) {
+            pairs[2*k] = v;
+            pairs[2*k+1] = c->heads[k];
+        }
+    }
+    return pairs;
+}
+
+
+static int compact_partition(NyCompact *c, int *lab, int *ptn)
+// Sort the vertices of c by color into nauty's (lab, ptn) at partition
+// level 0.  Return 1 if c is colored, -1 if not and 0 if out of memory,
+// like set_partition().
+{
+    if (c->colors == NULL) return -1;
+    return color_partition(c->colors, c->no_colors, c->no_vertices,
+            lab, ptn);
+}
+
+
+static int compact_set_coloring(NyCompact *c, PyObject *coloring)
+// Set the coloring of c from a list of disjoint sets of vertices, or
+// from an array of the colors of the vertices, as
+// Graph.set_vertex_coloring() does.
+// Return -1 with a Python exception set on error.
+{
+    PyObject *seq;
+    PyObject *iterator;
+    PyObject *item;
+    int *colors;
+    Py_ssize_t i, no_parts;
+    long x;
+    int v, rest;
+
+    if (PyObject_CheckBuffer(coloring)) {
+        if ((colors = malloc((c->no_vertices + 1) * sizeof(int))) == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        if ((v = read_colors(coloring, c->no_vertices, colors)) < 0) {
+            free(colors);
+            return -1;
+        }
+        free(c->colors);
+        if (v < 2) {
+            // a single color is no coloring
+            free(colors);
+            colors = NULL;
+            v = 0;
+        }
+        c->colors = colors;
+        c->no_colors = v;
+        return 0;
+    }
+    if (!PyObject_IsTrue(coloring)) {
+        free(c->colors);
+        c->colors = NULL;
+        c->no_colors = 0;
+        return 0;
+    }
+    if ((seq = PySequence_Fast(coloring, "a list of sets expected"))
+            == NULL) {
+        return -1;
+    }
+    no_parts = PySequence_Fast_GET_SIZE(seq);
+    if ((colors = malloc((c->no_vertices + 1) * sizeof(int))) == NULL) {
+        Py_DECREF(seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (v = 0; v < c->no_vertices; v++) colors[v] = -1;
+
+    for (i = 0; i < no_parts; i++) {
+        if ((iterator = PyObject_GetIter(PySequence_Fast_GET_ITEM(seq, i)))
+                == NULL) {
+            goto fail;
+        }
+        while ((item = PyIter_Next(iterator)) != NULL) {
+            x = PyLong_AsLong(item);
+            Py_DECREF(item);
+            if (x == -1 && PyErr_Occurred()) break;
+            if (x < 0 || x >= c->no_vertices || colors[x] >= 0) {
+                PyErr_Format(PyExc_ValueError, "Invalid partition: %R",
+                        coloring);
+                break;
+            }
+            colors[x] = i;
+        }
+        Py_DECREF(iterator);
+        if (PyErr_Occurred()) goto fail;
+    }
+    Py_DECREF(seq);
+
+    // vertices not listed go into an additional part
+    for (v = rest = 0; v < c->no_vertices; v++) {
+        if (colors[v] < 0) {
+            colors[v] = no_parts;
+            rest = 1;
+        }
+    }
+    free(c->colors);
+    c->colors = colors;
+    c->no_colors = no_parts + rest;
+    if (c->no_colors == 1) {
+        free(c->colors);
+        c->colors = NULL;
+        c->no_colors = 0;
+    }
+    return 0;
+
+fail:
+    Py_DECREF(seq);
+    free(colors);
+    return -1;
+}
+
+
+static NyGraph * compact_nygraph(NyCompact *c, int mode)
+// Load the compact graph c into a NyGraph for the given search engine,
+// straight from its arrays.
+{
+    NyGraph *g;
+    sparsegraph *sg;
+    int *pairs, *e;
+    size_t nde;
+    int v, k;
+
+    if ((g = acquire_nygraph(c->no_vertices,
+                    mode == NY_AUTO ? NY_SPARSE : mode)) == NULL) {
+        PyErr_SetString(PyExc_MemoryError, "Nauty NyGraph creation failed");
+        return NULL;
+    }
+    g->options->digraph = c->directed;
+    if (mode == NY_TRACES && g->options->digraph) {
+        PyErr_SetString(PyExc_ValueError,
+                "Traces does not support directed graphs");
+        release_nygraph(g);
+        return NULL;
+    }
+
+    sg = &g->sg;
+    nde = c->indptr[c->no_vertices];
+    if (g->mode == NY_DENSE) {
+        for (v = 0; v < c->no_vertices; v++) {
+            for (k = c->indptr[v]; k < c->indptr[v+1]; k++) {
+                make_edge(g, v, c->heads[k]);
+            }
+        }
+    } else if (g->options->digraph) {
+        // the lists are already sorted and free of duplicates
+        if (nde + 1 > sg->elen) {
+            if ((e = realloc(sg->e, (nde + 1) * sizeof(int))) == NULL) {
+                PyErr_NoMemory();
+                release_nygraph(g);
+                return NULL;
+            }
+            sg->e = e;
+            sg->elen = nde + 1;
+        }
+        memcpy(sg->e, c->heads, nde * sizeof(int));
+        for (v = 0; v < c->no_vertices; v++) {
+            sg->v[v] = c->indptr[v];
+            sg->d[v] = c->indptr[v+1] - c->indptr[v];
+        }
+        sg->nv = c->no_vertices;
+        sg->nde = nde;
+    } else {
+        if ((pairs = compact_pairs(c, 0)) == NULL) {
+            PyErr_NoMemory();
+            release_nygraph(g);
+            return NULL;
+        }
+        k = sparse_from_pairs(g, pairs, nde);
+        free(pairs);
+        if (k < 0) {
+            release_nygraph(g);
+            return NULL;
+        }
+    }
+
+    if ((k = compact_partition(c, g->lab, g->ptn)) == 0) {
+        PyErr_NoMemory();
+        release_nygraph(g);
+        return NULL;
+    }
+    g->options->defaultptn = k < 0 ? TRUE : FALSE;
+
+    if (mode == NY_AUTO && (g = settle_mode(g)) == NULL) {
+        PyErr_SetString(PyExc_MemoryError, "Nauty NyGraph creation failed");
+        return NULL;
+    }
+    return g;
+}
+
+
+static PyObject *
+compact_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+// An empty graph on no vertices until __init__ sets one, so that the
+// methods never meet a NULL indptr.
+{
+    NyCompact *self;
+
+    if ((self = (NyCompact *) type->tp_alloc(type, 0)) == NULL) return NULL;
+    if ((self->indptr = calloc(2, sizeof(int))) == NULL) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+    self->heads = self->indptr + 1;
+    return (PyObject *) self;
+}
+
+
+static int
+compact_init(NyCompact *self, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"number_of_vertices", "directed",
+        "adjacency_dict", "vertex_coloring", NULL};
+    PyObject *directed = NULL;
+    PyObject *adjdict = NULL;
+    PyObject *coloring = NULL;
+    int *pairs, *indptr;
+    size_t no_pairs;
+    int n, ret;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "i|OOO", kwlist,
+                &n, &directed, &adjdict, &coloring)) {
+        return -1;
+    }
+    if (n < 0 || n > INT_MAX / 2) {
+        PyErr_SetString(PyExc_ValueError, "invalid number_of_vertices");
+        return -1;
+    }
+    // on failure the object keeps its old graph
+    if ((indptr = calloc(n + 2, sizeof(int))) == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    free(self->indptr);
+    free(self->colors);
+    self->colors = NULL;
+    self->no_colors = 0;
+    self->no_vertices = n;
+    self->directed = directed != NULL && PyObject_IsTrue(directed);
+    self->indptr = indptr;
+    self->heads = self->indptr + n + 1;
+
+    if (adjdict != NULL) {
+        if (!PyDict_Check(adjdict)) {
+            PyErr_SetString(PyExc_TypeError,
+                    "'adjacency_dict' must be a dict");
+            return -1;
+        }
+        if (collect_pairs(adjdict, n, &pairs, &no_pairs) < 0) return -1;
+        ret = compact_from_pairs(self, pairs, no_pairs);
+        free(pairs);
+        if (ret < 0) return -1;
+    }
+    if (coloring != NULL) return compact_set_coloring(self, coloring);
+    return 0;
+}
+
+
+static void
+compact_dealloc(NyCompact *self)
+{
+    free(self->indptr);
+    free(self->colors);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+
+static PyObject *
+compact_get_number_of_vertices(NyCompact *self, void *closure)
+{
+    return PyLong_FromLong(self->no_vertices);
+}
+
+
+static PyObject *
+compact_get_directed(NyCompact *self, void *closure)
+{
+    return PyBool_FromLong(self->directed);
+}
+
+
+static int
+compact_set_directed(NyCompact *self, PyObject *value, void *closure)
+{
+    int directed;
+
+    if (value == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "cannot delete 'directed'");
+        return -1;
+    }
+    if ((directed = PyObject_IsTrue(value)) < 0) return -1;
+    self->directed = directed;
+    return 0;
+}
+
+
+static PyObject *
+compact_get_adjacency_dict(NyCompact *self, void *closure)
+{
+    PyObject *adjdict;
+    PyObject *adjlist;
+    PyObject *vertex;
+    int v, k;
+
+    if ((adjdict = PyDict_New()) == NULL) return NULL;
+    for (v = 0; v < self->no_vertices; v++) {
+        if (self->indptr[v] == self->indptr[v+1]) continue;
+        if ((adjlist = PyList_New(self->indptr[v+1] - self->indptr[v]))
+                == NULL) {
+            goto fail;
+        }
+        for (k = self->indptr[v]; k < self->indptr[v+1]; k++) {
+            if ((vertex = PyLong_FromLong(self->heads[k])) == NULL) {
+                Py_DECREF(adjlist);
+                goto fail;
+            }
+            PyList_SET_ITEM(adjlist, k - self->indptr[v], vertex);
+        }
+        if ((vertex = PyLong_FromLong(v)) == NULL ||
+                PyDict_SetItem(adjdict, vertex, adjlist) < 0) {
+            Py_XDECREF(vertex);
+            Py_DECREF(adjlist);
+            goto fail;
+        }
+        Py_DECREF(vertex);
+        Py_DECREF(adjlist);
+    }
+    return adjdict;
+
+fail:
+    Py_DECREF(adjdict);
+    return NULL;
+}
+
+
+static PyObject *
+compact_get_vertex_coloring(NyCompact *self, void *closure)
+{
+    PyObject *coloring;
+    PyObject *part;
+    PyObject *vertex;
+    int v, x;
+
+    if ((coloring = PyList_New(self->no_colors)) == NULL) return NULL;
+    for (x = 0; x < self->no_colors; x++) {
+        if ((part = PySet_New(NULL)) == NULL) goto fail;
+        PyList_SET_ITEM(coloring, x, part);
+    }
+    for (v = 0; v < self->no_vertices && self->colors != NULL; v++) {
+        if ((vertex = PyLong_FromLong(v)) == NULL ||
+                PySet_Add(PyList_GET_ITEM(coloring, self->colors[v]),
+                    vertex) < 0) {
+            Py_XDECREF(vertex);
+            goto fail;
+        }
+        Py_DECREF(vertex);
+    }
+    return coloring;
+
+fail:
+    Py_DECREF(coloring);
+    return NULL;
+}
+
+
+static PyObject *
+compact_set_adjacency_dict(NyCompact *self, PyObject *adjdict)
+{
+    int *pairs;
+    size_t no_pairs;
+    int ret;
+
+    if (!PyDict_Check(adjdict)) {
+        PyErr_SetString(PyExc_TypeError, "'adjacency_dict' must be a dict");
+        return NULL;
+    }
+    if (collect_pairs(adjdict, self->no_vertices, &pairs, &no_pairs) < 0) {
+        return NULL;
+    }
+    ret = compact_from_pairs(self, pairs, no_pairs);
+    free(pairs);
+    if (ret < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *
+compact_set_vertex_coloring(NyCompact *self, PyObject *coloring)
+{
+    if (compact_set_coloring(self, coloring) < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *
+compact_connect_vertex(NyCompact *self, PyObject *args)
+{
+    PyObject *neighbors;
+    PyObject *seq;
+    Py_ssize_t i, len;
+    size_t no_pairs;
+    int *pairs;
+    long v, y;
+    int ret;
+
+    if (!PyArg_ParseTuple(args, "lO", &v, &neighbors)) return NULL;
+    if (PyList_Check(neighbors)) {
+        Py_INCREF(neighbors);
+        seq = neighbors;
+    } else if ((seq = Py_BuildValue("[O]", neighbors)) == NULL) {
+        return NULL;
+    }
+    len = PyList_GET_SIZE(seq);
+    no_pairs = self->indptr[self->no_vertices];
+    if ((pairs = compact_pairs(self, 2 * len)) == NULL) {
+        Py_DECREF(seq);
+        return PyErr_NoMemory();
+    }
+    for (i = -1; i < len; i++) {
+        y = i < 0 ? v : PyLong_AsLong(PyList_GET_ITEM(seq, i));
+        if (y == -1 && PyErr_Occurred()) goto fail;
+        if (y < 0 || y >= self->no_vertices) {
+            PyErr_Format(PyExc_ValueError,
+                    "vertex %ld conflicts with number_of_vertices=%d",
+                    y, self->no_vertices);
+            goto fail;
+        }
+        if (i >= 0) {
+            pairs[2*no_pairs] = v;
+            pairs[2*no_pairs+1] = y;
+            no_pairs++;
+        }
+    }
+    Py_DECREF(seq);
+    ret = compact_from_pairs(self, pairs, no_pairs);
+    free(pairs);
+    if (ret < 0) return NULL;
+    Py_RETURN_NONE;
+
+fail:
+    Py_DECREF(seq);
+    free(pairs);
+    return NULL;
+}
+
+
+static PyObject *
+compact_set_edge_array(NyCompact *self, PyObject *edges)
+{
+    int *pairs;
+    size_t no_pairs;
+    int ret;
+
+    if (read_edge_array(edges, self->no_vertices, &pairs, &no_pairs, 0) < 0) {
+        return NULL;
+    }
+    ret = compact_from_pairs(self, pairs, no_pairs);
+    free(pairs);
+    if (ret < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *
+compact_copy(NyCompact *self, PyObject *unused)
+{
+    NyCompact *c;
+    size_t size;
+
+    c = (NyCompact *) Py_TYPE(self)->tp_alloc(Py_TYPE(self), 0);
+    if (c == NULL) return NULL;
+    c->no_vertices = self->no_vertices;
+    c->directed = self->directed;
+    c->no_colors = self->no_colors;
+
+    size = (self->no_vertices + 1 + self->indptr[self->no_vertices] + 1) *
+        sizeof(int);
+    if ((c->indptr = malloc(size)) == NULL ||
+            (self->colors != NULL && (c->colors =
+                malloc((self->no_vertices + 1) * sizeof(int))) == NULL)) {
+        Py_DECREF(c);
+        return PyErr_NoMemory();
+    }
+    memcpy(c->indptr, self->indptr, size);
+    c->heads = c->indptr + c->no_vertices + 1;
+    if (self->colors != NULL) {
+        memcpy(c->colors, self->colors, self->no_vertices * sizeof(int));
+    }
+    return (PyObject *) c;
+}
+
+
+static PyObject *
+compact_deepcopy(NyCompact *self, PyObject *memo)
+{
+    return compact_copy(self, NULL);
+}
+
+
+static PyObject *
+compact_reduce(NyCompact *self, PyObject *unused)
+{
+    return Py_BuildValue("(O(iNNN))", Py_TYPE(self), self->no_vertices,
+            PyBool_FromLong(self->directed),
+            compact_get_adjacency_dict(self, NULL),
+            compact_get_vertex_coloring(self, NULL));
+}
+
+
+static PyObject *
+compact_sizeof(NyCompact *self, PyObject *unused)
+{
+    size_t size = Py_TYPE(self)->tp_basicsize +
+        (self->no_vertices + 2 + self->indptr[self->no_vertices]) *
+        sizeof(int);
+
+    if (self->colors != NULL) size += (self->no_vertices + 1) * sizeof(int);
+    return PyLong_FromSize_t(size);
+}
+
+
+static PyGetSetDef compact_getset[] = {
+    {"number_of_vertices", (getter) compact_get_number_of_vertices, NULL,
+        "The number of vertices.", NULL},
+    {"directed", (getter) compact_get_directed,
+        (setter) compact_set_directed,
+        "Whether the graph is directed.", NULL},
+    {"adjacency_dict", (getter) compact_get_adjacency_dict, NULL,
+        "A new adjacency dictionary of the graph.", NULL},
+    {"vertex_coloring", (getter) compact_get_vertex_coloring, NULL,
+        "A new list of the parts of the vertex coloring.", NULL},
+    {NULL}
+};
+
+
+static PyMethodDef compact_methods[] = {
+    {"set_adjacency_dict", (PyCFunction) compact_set_adjacency_dict, METH_O,
+        "Set the adjacency relations of the graph."},
+    {"set_vertex_coloring", (PyCFunction) compact_set_vertex_coloring,
+        METH_O, "Define a vertex coloring of the graph."},
+    {"connect_vertex", (PyCFunction) compact_connect_vertex, METH_VARARGS,
+        "Connect a vertex to some other vertices."},
+    {"_set_edge_array", (PyCFunction) compact_set_edge_array, METH_O,
+        "Set the adjacency relations from edge arrays."},
+    {"copy", (PyCFunction) compact_copy, METH_NOARGS,
+        "Make a copy of the graph."},
+    {"__copy__", (PyCFunction) compact_copy, METH_NOARGS, NULL},
+    {"__deepcopy__", (PyCFunction) compact_deepcopy, METH_O, NULL},
+    {"__reduce__", (PyCFunction) compact_reduce, METH_NOARGS, NULL},
+    {"__sizeof__", (PyCFunction) compact_sizeof, METH_NOARGS, NULL},
+    {NULL}
+};
+
+
+static PyTypeObject NyCompactType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "nautywrap.CompactGraph",
+    .tp_doc = PyDoc_STR("Graph stored in compressed sparse row form"),
+    .tp_basicsize = sizeof(NyCompact),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_new = compact_new,
+    .tp_init = (initproc) compact_init,
+    .tp_dealloc = (destructor) compact_dealloc,
+    .tp_methods = compact_methods,
+    .tp_getset = compact_getset,
+};
+
+
+NyGraph * _make_nygraph(PyObject *py_graph, int mode)
+// Convert the Python NyGraph object into a Nauty/C NyGraph object
+// for the given search engine and set Nauty options.
+{
+    NyGraph *g;
+    int n;
+    set *rowp;
+ 
+    PyObject *adjdict;
+    PyObject *edges;
+    PyObject *key;
+    PyObject *adjlist;
+    PyObject *p;
+
+    int i;
+    int adjlist_length;
+    int x, y;
+    int *pairs;
+    size_t no_pairs;
+
+    if (mode < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                "mode must be 'dense', 'sparse', 'traces' or 'auto'");
+        return NULL;
+    }
+    if (PyObject_TypeCheck(py_graph, &NyCompactType)) {
+        return compact_nygraph((NyCompact *) py_graph, mode);
+    }
+
+    // get the number of vertices
+    if ((p = PyObject_GetAttrString(py_graph, "number_of_vertices")) == NULL) {
+        PyErr_SetString(PyExc_TypeError,
+                "Missing 'number_of_vertices' attribute");
+        return NULL;
+    }
+#if PY_MAJOR_VERSION >= 3
+    n = PyLong_AS_LONG(p);
+#else
+    n = PyInt_AS_LONG(p);
+#endif
+    Py_DECREF(p);
+
+    // create an empty Nauty NyGraph object; the engine is chosen
+    // for NY_AUTO once the sparsegraph and the coloring are known
+    if ((g = acquire_nygraph(n, mode == NY_AUTO ? NY_SPARSE : mode)) == NULL) {
+        PyErr_SetString(PyExc_MemoryError, "Nauty NyGraph creation failed");
+        return NULL;
+    }
+
+    // get directed attribute
+    if ((p = PyObject_GetAttrString(py_graph, "directed")) == NULL) {
+        PyErr_SetString(PyExc_TypeError, "missing 'directed' attribute");
+        release_nygraph(g);
+        return NULL;
+    }
+    if (PyObject_IsTrue(p)) {
+        g->options->digraph = TRUE;
+    } else {
+        g->options->digraph = FALSE;
+    }
+    Py_DECREF(p);
+    if (mode == NY_TRACES && g->options->digraph) {
+        PyErr_SetString(PyExc_ValueError,
+                "Traces does not support directed graphs");
+        release_nygraph(g);
+        return NULL;
+    }
+
+    // the edges come from an edge array or the adjacency dictionary
+    if ((edges = get_edge_array(py_graph)) != NULL) {
+        x = fill_edge_array(g, edges);
+        Py_DECREF(edges);
+        if (x < 0) {
+            release_nygraph(g);
+            return NULL;
+        }
+    } else {
+        // get the adjacency list dictionary object
+        if ((adjdict = PyObject_GetAttrString(py_graph, "adjacency_dict"))
+                == NULL) {
+            PyErr_SetString(PyExc_TypeError,
+                    "missing 'adjacency_dict' attribute");
+            release_nygraph(g);
+            return NULL;
+        }
+
+        if (mode != NY_DENSE) {
+            if (fill_sparse(g, adjdict) < 0) {
+                Py_DECREF(adjdict);
+                release_nygraph(g);
+                return NULL;
+            }
+        }
+
+        // iterate over the adjacency list setting
+        // the adjacency matrix in the Nauty NyGraph g
+        Py_ssize_t pos = 0;
+        while (mode == NY_DENSE &&
+                PyDict_Next(adjdict, &pos, &key, &adjlist)) {
+#if PY_MAJOR_VERSION >= 3
+            x = PyLong_AS_LONG(key);
+#else
+            x = PyInt_AS_LONG(key);
+#endif
+            adjlist_length =  PyObject_Length(adjlist);
+            rowp = GRAPHROW(g->matrix, x, g->no_setwords);
+            for (i=0; i < adjlist_length; i++) {
+                p = PyList_GET_ITEM(adjlist, i);
+#if PY_MAJOR_VERSION >= 3
+                y = PyLong_AS_LONG(p);
+#else
+                y = PyInt_AS_LONG(p);
+#endif
+                ADDELEMENT(rowp, y);
+                if (g->options->digraph == FALSE) {
+                    ADDELEMENT((GRAPHROW(g->matrix, y, g->no_setwords)), x);
+                }
+            }
+        }
+
+        Py_DECREF(adjdict);
+    }
+
+    // take care of coloring
+    x = set_partition(py_graph, g->no_vertices, g->lab, g->ptn);
+    if (x < 0) {
+        g->options->defaultptn = TRUE;
+    } else if (x == 0) {
+        release_nygraph(g);
+        return NULL;
+    } else {
+        g->options->defaultptn = FALSE;
+    }
+
+    // edge colors go into layers of copies of the vertices
+    if ((x = read_edge_colors(py_graph, g->no_vertices,
+                    g->options->digraph, &pairs, &no_pairs)) < 0) {
+        release_nygraph(g);
+        return NULL;
+    }
+    if (x > 0) {
+        g = layer_nygraph(g, pairs, no_pairs, x);
+        free(pairs);
+        if (g == NULL) return NULL;
+    }
+
+    if (mode == NY_AUTO && (g = settle_mode(g)) == NULL) {
+        PyErr_SetString(PyExc_MemoryError, "Nauty NyGraph creation failed");
+        return NULL;
+    }
+
+    return g;
+}
+
+
+static NyPacked * pack_compact(NyCompact *c)
+// pack_graph() for a compact graph
+{
+    NyPacked *p;
+    int n = c->no_vertices;
+    int colored;
+
+    if ((p = malloc(sizeof(NyPacked))) == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    p->no_vertices = n;
+    p->digraph = c->directed;
+    p->no_edges = c->indptr[n];
+    if ((p->edges = compact_pairs(c, 2 * (size_t) n)) == NULL) {
+        free(p);
+        PyErr_NoMemory();
+        return NULL;
+    }
+    p->lab = p->edges + 2 * p->no_edges;
+    p->ptn = p->lab + n;
+    if ((colored = compact_partition(c, p->lab, p->ptn)) == 0) {
+        destroy_packed(p);
+        PyErr_NoMemory();
+        return NULL;
+    }
+    p->colored = colored > 0 ? TRUE : FALSE;
+    return p;
+}
+
+
+static NyPacked * pack_graph(PyObject *py_graph)
+// Convert the Python NyGraph object into a NyPacked object which can
+// be loaded into a NyGraph later without access to Python objects.
+{
+    NyPacked *p;
+    PyObject *adjdict;
+    PyObject *key;
+    PyObject *adjlist;
+    PyObject *seq;
+    PyObject *attr;
+    Py_ssize_t pos, i, len;
+    size_t no_edges, k;
+    long n, x, y;
+    int colored;
+
+    if (PyObject_TypeCheck(py_graph, &NyCompactType)) {
+        return pack_compact((NyCompact *) py_graph);
+    }
+
+    if ((attr = PyObject_GetAttrString(py_graph, "number_of_vertices"))
+            == NULL) {
+        return NULL;
+    }
+    n = PyLong_AsLong(attr);
+    Py_DECREF(attr);
+    if (n == -1 && PyErr_Occurred()) return NULL;
+    if (n < 0 || n > INT_MAX / 2) {
+        PyErr_SetString(PyExc_ValueError, "invalid number_of_vertices");
+        return NULL;
+    }
+    if ((attr = PyObject_GetAttrString(py_graph, "_edge_colors")) == NULL) {
+        PyErr_Clear();
+    } else {
+        colored = PyObject_IsTrue(attr);
+        Py_DECREF(attr);
+        if (colored) {
+            PyErr_SetString(PyExc_ValueError,
+                    "batches of graphs cannot have edge colors");
+            return NULL;
+        }
+    }
+
+    if ((p = malloc(sizeof(NyPacked))) == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    p->no_vertices = n;
+    p->no_edges = 0;
+    p->edges = NULL;
+
+    if ((attr = PyObject_GetAttrString(py_graph, "directed")) == NULL) {
+        destroy_packed(p);
+        return NULL;
+    }
+    p->digraph = PyObject_IsTrue(attr) ? TRUE : FALSE;
+    Py_DECREF(attr);
+
+    if ((attr = get_edge_array(py_graph)) != NULL) {
+        x = read_edge_array(attr, n, &p->edges, &no_edges, 2 * n);
+        Py_DECREF(attr);
+        if (x < 0) {
+            p->edges = NULL;
+            destroy_packed(p);
+            return NULL;
+        }
+        p->no_edges = no_edges;
+        p->lab = p->edges + 2 * no_edges;
+        p->ptn = p->lab + n;
+        goto coloring;
+    }
+
+    if ((adjdict = PyObject_GetAttrString(py_graph, "adjacency_dict"))
+            == NULL) {
+        destroy_packed(p);
+        return NULL;
+    }
+    if (!PyDict_Check(adjdict)) {
+        PyErr_SetString(PyExc_TypeError, "'adjacency_dict' must be a dict");
+        goto fail;
+    }
+
+    // count the edges first so that a single allocation is enough
+    pos = 0;
+    no_edges = 0;
+    while (PyDict_Next(adjdict, &pos, &key, &adjlist)) {
+        if ((len = PyObject_Length(adjlist)) < 0) goto fail;
+        no_edges += len;
+    }
+    if ((p->edges = malloc((2 * no_edges + 2 * n + 1) * sizeof(int)))
+            == NULL) {
+        PyErr_NoMemory();
+        goto fail;
+    }
+    p->lab = p->edges + 2 * no_edges;
+    p->ptn = p->lab + n;
+
+    pos = 0;
+    k = 0;
+    while (PyDict_Next(adjdict, &pos, &key, &adjlist)) {
+        x = PyLong_AsLong(key);
+        if (x == -1 && PyErr_Occurred()) goto fail;
+        if ((seq = PySequence_Fast(adjlist, "adjacency list expected"))
+                == NULL) {
+            goto fail;
+        }
+        len = PySequence_Fast_GET_SIZE(seq);
+        for (i = 0; i < len && k < no_edges; i++, k++) {
+            y = PyLong_AsLong(PySequence_Fast_GET_ITEM(seq, i));
+            if (y == -1 && PyErr_Occurred()) {
+                Py_DECREF(seq);
+                goto fail;
+            }
+            if (x < 0 || x >= n || y < 0 || y >= n) {
+                PyErr_Format(PyExc_ValueError,
+                        "edge (%ld, %ld) conflicts with "
+                        "number_of_vertices=%ld", x, y, n);
+                Py_DECREF(seq);
+                goto fail;
+            }
+            p->edges[2*k] = x;
+            p->edges[2*k+1] = y;
+        }
+        Py_DECREF(seq);
+    }
+    p->no_edges = k;
+    Py_DECREF(adjdict);
+
+coloring:
+    colored = set_partition(py_graph, p->no_vertices, p->lab, p->ptn);
+    if (colored == 0) {
+        destroy_packed(p);
+        return NULL;
+    }
+    p->colored = colored > 0 ? TRUE : FALSE;
+
+    return p;
+
+fail:
+    Py_DECREF(adjdict);
+    destroy_packed(p);
+    return NULL;
+}
+
+
+// Persistent handle type -----------------------------------------------------
+
+static PyObject* new_handle(PyTypeObject *type, NyGraph *g)
+// Wrap g into a handle of the given type, releasing g on failure.
+{
+    NyHandle *h;
+
+    if ((h = (NyHandle *) type->tp_alloc(type, 0)) == NULL) {
+        release_nygraph(g);
+        return NULL;
+    }
+    h->graph = g;
+    if (!g->options->defaultptn) {
+        if ((h->partition = malloc((2 * (size_t) g->no_vertices + 1) *
+                        sizeof(int))) == NULL) {
+            Py_DECREF(h);
+            return PyErr_NoMemory();
+        }
+        memcpy(h->partition, g->lab, g->no_vertices * sizeof(int));
+        memcpy(h->partition + g->no_vertices, g->ptn,
+                g->no_vertices * sizeof(int));
+    }
+    return (PyObject *) h;
+}
+
+
+static NyGraph * handle_graph(NyHandle *h)
+// The NyGraph of h if it can be used now, NULL with an exception set
+// otherwise.
+{
+    if (h->graph == NULL) {
+        PyErr_SetString(PyExc_ValueError, "the handle has been released");
+        return NULL;
+    }
+    if (h->busy) {
+        PyErr_SetString(PyExc_RuntimeError,
+                "the handle is being searched by another thread");
+        return NULL;
+    }
+    return h->graph;
+}
+
+
+static NyGraph * handle_search(NyHandle *h, boolean getcanon)
+// Run nauty on the current graph of h, computing the generators or
+// the canonical labeling.  Return NULL with an exception set on error.
+{
+    NyGraph *g;
+    int k;
+
+    if ((g = handle_graph(h)) == NULL) return NULL;
+    if (getcanon && extend_canonical(g) == NULL) {
+        PyErr_SetString(PyExc_MemoryError,
+                "Allocating canonical matrix failed");
+        return NULL;
+    }
+    g->options->getcanon = getcanon;
+    g->options->userautomproc = getcanon ? NULL : store_generator;
+    g->no_generators = 0;
+    g->generators_lost = FALSE;
+    if (h->partition != NULL) {
+        memcpy(g->lab, h->partition, g->no_vertices * sizeof(int));
+        memcpy(g->ptn, h->partition + g->no_vertices,
+                g->no_vertices * sizeof(int));
+    }
+
+    h->busy = TRUE;
+    k = run_nauty(g);
+    h->busy = FALSE;
+    return k < 0 ? NULL : g;
+}
+
+
+static NyGraph * handle_edge(NyHandle *h, PyObject *args, int *i, int *j)
+// Parse the end points of an edge of the graph of h.
+{
+    NyGraph *g;
+
+    if (!PyArg_ParseTuple(args, "ii", i, j)) return NULL;
+    if ((g = handle_graph(h)) == NULL) return NULL;
+    if (*i < 0 || *i >= g->no_vertices || *j < 0 || *j >= g->no_vertices) {
+        PyErr_Format(PyExc_ValueError,
+                "edge (%d, %d) conflicts with number_of_vertices=%d",
+                *i, *j, g->no_vertices);
+        return NULL;
+    }
+    return g;
+}
+
+
+static PyObject *
+handle_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"g", NULL};
+    PyObject *py_graph;
+    NyGraph *g;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O", kwlist, &py_graph)) {
+        return NULL;
+    }
+    if ((g = _make_nygraph(py_graph, NY_DENSE)) == NULL) return NULL;
+    if (g->no_base_vertices < g->no_vertices) {
+        PyErr_SetString(PyExc_ValueError,
+                "a Handle cannot keep edge colors");
+        release_nygraph(g);
+        return NULL;
+    }
+    return new_handle(type, g);
+}
+
+
+static void
+handle_dealloc(NyHandle *self)
+{
+    if (self->graph != NULL) release_nygraph(self->graph);
+    free(self->partition);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+
+static PyObject *
+handle_add_edge(NyHandle *self, PyObject *args)
+{
+    NyGraph *g;
+    int i, j;
+
+    if ((g = handle_edge(self, args, &i, &j)) == NULL) return NULL;
+    make_edge(g, i, j);
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *
+handle_remove_edge(NyHandle *self, PyObject *args)
+{
+    NyGraph *g;
+    int i, j;
+
+    if ((g = handle_edge(self, args, &i, &j)) == NULL) return NULL;
+    DELELEMENT((GRAPHROW(g->matrix, i, g->no_setwords)), j);
+    if (g->options->digraph == FALSE) {
+        DELELEMENT((GRAPHROW(g->matrix, j, g->no_setwords)), i);
+    }
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *
+handle_has_edge(NyHandle *self, PyObject *args)
+{
+    NyGraph *g;
+    int i, j;
+
+    if ((g = handle_edge(self, args, &i, &j)) == NULL) return NULL;
+    return PyBool_FromLong(
+            ISELEMENT((GRAPHROW(g->matrix, i, g->no_setwords)), j));
+}
+
+
+static PyObject *
+handle_autgrp(NyHandle *self, PyObject *unused)
+{
+    NyGraph *g;
+
+    if ((g = handle_search(self, FALSE)) == NULL) return NULL;
+    return py_auto_group(g, FALSE);
+}
+
+
+static PyObject *
+handle_certificate(NyHandle *self, PyObject *args)
+{
+    NyGraph *g;
+    const char *format = "raw";
+    int fmt;
+
+    if (!PyArg_ParseTuple(args, "|s", &format)) return NULL;
+    if ((fmt = parse_format(format)) < 0) {
+        PyErr_Format(PyExc_ValueError,
+                "unknown certificate format '%s'", format);
+        return NULL;
+    }
+    if ((g = handle_search(self, TRUE)) == NULL) return NULL;
+    return dense_certificate(g->cmatrix, g->no_setwords, g->no_vertices,
+            g->options->digraph, fmt);
+}
+
+
+static PyObject *
+handle_canon_label(NyHandle *self, PyObject *unused)
+{
+    NyGraph *g;
+
+    if ((g = handle_search(self, TRUE)) == NULL) return NULL;
+    return py_int_list(g->lab, g->no_vertices);
+}
+
+
+static PyObject *
+handle_release(NyHandle *self, PyObject *unused)
+{
+    if (handle_graph(self) == NULL) return NULL;
+    release_nygraph(self->graph);
+    self->graph = NULL;
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *
+handle_get_number_of_vertices(NyHandle *self, void *closure)
+{
+    if (handle_graph(self) == NULL) return NULL;
+    return PyLong_FromLong(self->graph->no_vertices);
+}
+
+
+static PyObject *
+handle_get_directed(NyHandle *self, void *closure)
+{
+    if (handle_graph(self) == NULL) return NULL;
+    return PyBool_FromLong(self->graph->options->digraph);
+}
+
+
+static PyGetSetDef handle_getset[] = {
+    {"number_of_vertices", (getter) handle_get_number_of_vertices, NULL,
+        "The number of vertices.", NULL},
+    {"directed", (getter) handle_get_directed, NULL,
+        "Whether the graph is directed.", NULL},
+    {NULL}
+};
+
+
+static PyMethodDef handle_methods[] = {
+    {"add_edge", (PyCFunction) handle_add_edge, METH_VARARGS,
+        "add_edge(i, j): connect vertex i to vertex j."},
+    {"remove_edge", (PyCFunction) handle_remove_edge, METH_VARARGS,
+        "remove_edge(i, j): disconnect vertex i from vertex j."},
+    {"has_edge", (PyCFunction) handle_has_edge, METH_VARARGS,
+        "has_edge(i, j): whether vertex i is connected to vertex j."},
+    {"autgrp", (PyCFunction) handle_autgrp, METH_NOARGS,
+        "autgrp(): the automorphism group, as pynauty.autgrp()."},
+    {"certificate", (PyCFunction) handle_certificate, METH_VARARGS,
+        "certificate(format='raw'): the certificate, as "
+        "pynauty.certificate()."},
+    {"canon_label", (PyCFunction) handle_canon_label, METH_NOARGS,
+        "canon_label(): the canonical labeling, as pynauty.canon_label()."},
+    {"release", (PyCFunction) handle_release, METH_NOARGS,
+        "release(): free the graph; the handle cannot be used after."},
+    {NULL}
+};
+
+
+static PyTypeObject NyHandleType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "nautywrap.Handle",
+    .tp_doc = PyDoc_STR("Handle(g): a Nauty graph edited in place"),
+    .tp_basicsize = sizeof(NyHandle),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_new = handle_new,
+    .tp_dealloc = (destructor) handle_dealloc,
+    .tp_methods = handle_methods,
+    .tp_getset = handle_getset,
+};
+
+
+// Exported (module level) Python functions ----------------------------------
+
+static char make_nygraph_docs[] =
+"make_nygraph(g): \n\
+    Convert the Python NyGraph object into a Nauty/C NyGraph object.\n\
+    Return a Handle to the Nauty/C NyGraph object.\n";
+
+static PyObject*
+make_nygraph(PyObject *self, PyObject *args)
+// Convert the Python NyGraph object into a Nauty/C NyGraph object
+// and set Nauty options.
+{
+    PyObject * py_graph;
+    NyGraph * g;
+
+    if (!PyArg_ParseTuple(args, "O", &py_graph)) {
+        PyErr_SetString(PyExc_TypeError, "Missing argument.");
+        return NULL;
+    }
+
+    g = _make_nygraph(py_graph, NY_DENSE);
+    if (g == NULL) return NULL;
+    if (g->no_base_vertices < g->no_vertices) {
+        PyErr_SetString(PyExc_ValueError,
+                "a Handle cannot keep edge colors");
+        release_nygraph(g);
+        return NULL;
+    }
+
+    return new_handle(&NyHandleType, g);
+}
+
+
+static char delete_nygraph_docs[] =
+"delete_nygraph(g): \n\
+    Free the allocated memory for Nauty NyGraph.\n";
+
+static PyObject*
+delete_nygraph(PyObject *self, PyObject *args) {
+    PyObject *p;
+
+    if (!PyArg_ParseTuple(args, "O!", &NyHandleType, &p)) {
+        return NULL;
+    }
+    return handle_release((NyHandle *) p, NULL);
+}
+
+
+static char graph_autgrp_docs[] =
+"graph_autgrp(g, mode='dense', as_array=False, on_generator=None,\n\
+        timeout=0, max_nodes=0, invariant=None, invararg=0,\n\
+        mininvarlevel=0, maxinvarlevel=1, schreier=False,\n\
+        schreier_fails=0, tc_level=-1, refine=None):\n\
+    Return the (generators, order, orbits, orbit_no)\n\
+    of the automorphism group of NyGraph 'g'.  The generators and\n\
+    orbits are int arrays rather than lists if 'as_array'.  If\n\
+    'on_generator' is given, the generators are passed to it as they\n\
+    are found and their number is returned in place of them.\n\
+    Raise TimeoutError if the search takes more than 'timeout' seconds\n\
+    or 'max_nodes' nodes of the search tree, unless they are 0.\n\
+    The search applies the named vertex 'invariant' of nautinv.c with\n\
+    the given options, if any, and prunes with the Schreier-Sims\n\
+    method if 'schreier'.  'tc_level', unless negative, and 'refine',\n\
+    unless None, set the target cell level and refinement procedure.\n";
+
+static PyObject*
+graph_autgrp(PyObject *self, PyObject *args)
+{
+    PyObject *py_graph;
+    NyGraph * g;
+    PyObject *pyret;
+    PyObject *on_generator = Py_None;
+    Py_buffer view;
+    const char *mode = "dense";
+    double timeout = 0;
+    long max_nodes = 0;
+    NySearch search;
+    int as_array = 0;
+    const char *invariant = NULL;
+    int invararg = 0, mininvarlevel = 0, maxinvarlevel = 1;
+    int schreier = 0, no_fails = 0;
+    int tc_level = -1;
+    PyObject *refine = Py_None;
+
+    if (!PyArg_ParseTuple(args, "O|siOdlziiipiiO", &py_graph, &mode,
+                &as_array, &on_generator, &timeout, &max_nodes, &invariant,
+                &invararg, &mininvarlevel, &maxinvarlevel, &schreier,
+                &no_fails, &tc_level, &refine)) {
+        return NULL;
+    }
+    g = _make_nygraph(py_graph, parse_mode(mode));
+    if (g == NULL) return NULL;
+    if (set_invariant(g, invariant, invararg, mininvarlevel,
+                maxinvarlevel) < 0 ||
+            set_refinement(g, tc_level, refine) < 0) {
+        release_nygraph(g);
+        return NULL;
+    }
+    g->options->schreier = schreier ? TRUE : FALSE;
+    g->schreier_fails = no_fails;
+
+    // compute automorphism group only
+    g->options->getcanon = FALSE;
+    g->options->userautomproc = store_generator;
+
+    init_search(&search, g, timeout, max_nodes);
+    if (on_generator != Py_None &&
+            open_stream(&search, on_generator, &view) < 0) {
+        release_nygraph(g);
+        return NULL;
+    }
+
+    // *** nauty ***
+    // compute automorphism group
+    if (run_checked(&search) < 0) {
+        pyret = NULL;
+    } else if ((pyret = py_auto_group(g, as_array)) != NULL &&
+            on_generator != Py_None) {
+        // the number of generators in place of them
+        PyTuple_SetItem(pyret, 0, PyLong_FromLong(search.no_streamed));
+    }
+    if (search.slots != NULL) PyBuffer_Release(&view);
+    release_nygraph(g);
+    return pyret;
+}
+
+
+static char graph_mode_docs[] =
+"graph_mode(g): \n\
+    Return the name of the search engine mode='auto' uses for NyGraph 'g'.\n";
+
+static PyObject*
+graph_mode(PyObject *self, PyObject *args)
+{
+    static const char *names[] = {"dense", "sparse", "traces"};
+    PyObject *py_graph;
+    NyGraph * g;
+    PyObject *pyret;
+
+    if (!PyArg_ParseTuple(args, "O", &py_graph)) {
+        PyErr_SetString(PyExc_TypeError, "Missing argument.");
+        return NULL;
+    }
+    g = _make_nygraph(py_graph, NY_AUTO);
+    if (g == NULL) return NULL;
+
+    pyret = Py_BuildValue("s", names[g->mode]);
+    release_nygraph(g);
+    return pyret;
+}
+
+
+static char graph_key_docs[] =
+"graph_key(g): \n\
+    Return (key, hash) for NyGraph 'g' as it is labeled: 'key' is a\n\
+    byte string equal for two graphs exactly if they have the same\n\
+    vertices, edges and ordered coloring, and 'hash' is a 62 bit\n\
+    value of it built from hashgraph_sg().\n";
+
+static PyObject*
+graph_key(PyObject *self, PyObject *args)
+{
+    PyObject *py_graph;
+    PyObject *pyret = NULL;
+    PyObject *bytes;
+    NyGraph *g;
+    int32_t *key, *p;
+    size_t no_ints;
+    unsigned long long h;
+    int n, i, cell;
+
+    if (!PyArg_ParseTuple(args, "O", &py_graph)) return NULL;
+    g = _make_nygraph(py_graph, NY_SPARSE);
+    if (g == NULL) return NULL;
+    n = g->no_vertices;
+
+    // n, digraph, the cell of each vertex, the degrees, then the
+    // sorted neighbour lists
+    no_ints = 2 + 2 * (size_t) n + g->sg.nde;
+    if ((key = malloc(no_ints * sizeof(int32_t))) == NULL) {
+        release_nygraph(g);
+        return PyErr_NoMemory();
+    }
+    key[0] = n;
+    key[1] = g->options->digraph ? 1 : 0;
+    for (i = 0, cell = 0; i < n; i++) {
+        if (g->options->defaultptn) {
+            key[2 + i] = 0;
+        } else {
+            key[2 + g->lab[i]] = cell;
+            if (g->ptn[i] == 0) cell++;
+        }
+    }
+    p = key + 2 + n;
+    for (i = 0; i < n; i++) *p++ = g->sg.d[i];
+    for (i = 0; i < n; i++) {
+        memcpy(p, g->sg.e + g->sg.v[i], g->sg.d[i] * sizeof(int));
+        qsort(p, g->sg.d[i], sizeof(int), compare_ints);
+        p += g->sg.d[i];
+    }
+
+    // two 31 bit graph hashes, the coloring mixed into the second
+    h = (unsigned long long) hashgraph_sg(&g->sg, 0x2C31A1BBL) << 31;
+    h |= (unsigned long long) hashgraph_sg(&g->sg, 0x5B7E03C5L);
+    for (i = 0; i < n + 2; i++) {
+        h = (h ^ (unsigned long long) key[i]) * 0x100000001B3ULL;
+    }
+    h &= 0x3FFFFFFFFFFFFFFFULL;
+
+    bytes = PyBytes_FromStringAndSize((char *) key,
+            (Py_ssize_t) (no_ints * sizeof(int32_t)));
+    free(key);
+    if (bytes != NULL) pyret = Py_BuildValue("(NK)", bytes, h);
+    release_nygraph(g);
+    return pyret;
+}
+
+
+static char graph_cert_docs[] =
+"graph_cert(g, mode='dense', format='raw', timeout=0, max_nodes=0,\n\
+        invariant=None, invararg=0, mininvarlevel=0, maxinvarlevel=1,\n\
+        schreier=False, schreier_fails=0, tc_level=-1, refine=None): \n\
+    Return the unique certificate of NyGraph 'g' in the given format:\n\
+    'raw', 'edges', 'sparse6', 'hash128' or 'hash256'.\n\
+    Certificates computed in different modes are not comparable.\n\
+    Raise TimeoutError if the search takes more than 'timeout' seconds\n\
+    or 'max_nodes' nodes of the search tree, unless they are 0.\n\
+    The search applies the named vertex 'invariant' of nautinv.c with\n\
+    the given options, if any, and prunes with the Schreier-Sims\n\
+    method if 'schreier'.  'tc_level', unless negative, and 'refine',\n\
+    unless None, set the target cell level and refinement procedure.\n";
+
+static PyObject*
+graph_cert(PyObject *self, PyObject *args)
+{
+    PyObject *py_graph;
+    NyGraph * g;
+    PyObject *pyret;
+    const char *mode = "dense";
+    const char *format = "raw";
+    double timeout = 0;
+    long max_nodes = 0;
+    NySearch search;
+    int fmt;
+    const char *invariant = NULL;
+    int invararg = 0, mininvarlevel = 0, maxinvarlevel = 1;
+    int schreier = 0, no_fails = 0;
+    int tc_level = -1;
+    PyObject *refine = Py_None;
+
+    if (!PyArg_ParseTuple(args, "O|ssdlziiipiiO", &py_graph, &mode, &format,
+                &timeout, &max_nodes, &invariant, &invararg,
+                &mininvarlevel, &maxinvarlevel, &schreier, &no_fails,
+                &tc_level, &refine)) {
+        return NULL;
+    }
+    if ((fmt = parse_format(format)) < 0) {
+        PyErr_Format(PyExc_ValueError,
+                "unknown certificate format '%s'", format);
+        return NULL;
+    }
+    g = _make_nygraph(py_graph, parse_mode(mode));
+    if (g == NULL) return NULL;
+    if (set_invariant(g, invariant, invararg, mininvarlevel,
+                maxinvarlevel) < 0 ||
+            set_refinement(g, tc_level, refine) < 0) {
+        release_nygraph(g);
+        return NULL;
+    }
+    g->options->schreier = schreier ? TRUE : FALSE;
+    g->schreier_fails = no_fails;
+
+    // produce graph certificate by computing canonical labeling
+    g->options->getcanon = TRUE;
+    if (extend_canonical(g) == NULL) {
+        PyErr_SetString(PyExc_MemoryError,
+                "Allocating canonical matrix failed");
+        release_nygraph(g);
+        return NULL;
+    }
+    // the produced generators are ignored
+    g->options->userautomproc = NULL;
+
+    // *** nauty ***
+    init_search(&search, g, timeout, max_nodes);
+    if (run_checked(&search) < 0) {
+        release_nygraph(g);
+        return NULL;
+    }
+
+    if (g->mode != NY_DENSE) {
+        pyret = sparse_certificate(g, fmt);
+    } else {
+        pyret = dense_certificate(g->cmatrix, g->no_setwords,
+                g->no_vertices, g->options->digraph, fmt);
+    }
+    release_nygraph(g);
+    return pyret;
+}
+
+static char graph_canonlab_docs[] =
+"graph_canonlab(g, mode='dense'): \n\
+    Return the canonical relabelling of NyGraph 'g'.\n";
+
+static PyObject*
+graph_canonlab(PyObject *self, PyObject *args)
+{
+    PyObject *py_graph;
+    NyGraph * g;
+    PyObject *pyret;
+    const char *mode = "dense";
+
+    if (!PyArg_ParseTuple(args, "O|s", &py_graph, &mode)) {
+        PyErr_SetString(PyExc_TypeError, "Missing argument.");
+        return NULL;
+    }
+    g = _make_nygraph(py_graph, parse_mode(mode));
+    if (g == NULL) return NULL;
+
+    // produce graph certificate by computing canonical labeling
+    g->options->getcanon = TRUE;
+    if (extend_canonical(g) == NULL) {
+        PyErr_SetString(PyExc_MemoryError,
+                "Allocating canonical matrix failed");
+        release_nygraph(g);
+        return NULL;
+    }
+    // the produced generators are ignored
+    g->options->userautomproc = NULL;
+
+    // *** nauty ***
+    if (run_nauty(g) < 0) {
+        release_nygraph(g);
+        return NULL;
+    }
+
+    pyret = py_int_list(g->lab, g->no_base_vertices);
+
+    release_nygraph(g);
+    return pyret;
+}
+
+static PyObject* canonical_adjacency(NyGraph *g)
+// The adjacency dict of the canonical graph of g with full neighbour
+// lists, that is with both directions of the edges of undirected graphs.
+{
+    PyObject *adjdict;
+    PyObject *adjlist;
+    PyObject *vertex;
+    sparsegraph *csg = &g->csg;
+    set *rowp;
+    size_t k;
+    int i, j;
+
+    if ((adjdict = PyDict_New()) == NULL) return NULL;
+    if (g->mode != NY_DENSE) sortlists_sg(csg);
+
+    for (i = 0; i < g->no_vertices; i++) {
+        if ((adjlist = PyList_New(0)) == NULL) goto fail;
+        if (g->mode == NY_DENSE) {
+            rowp = GRAPHROW(g->cmatrix, i, g->no_setwords);
+            for (j = -1; (j = nextelement(rowp, g->no_setwords, j)) >= 0;) {
+                if ((vertex = PyLong_FromLong(j)) == NULL ||
+                        PyList_Append(adjlist, vertex) < 0) {
+                    Py_XDECREF(vertex);
+                    Py_DECREF(adjlist);
+                    goto fail;
+                }
+                Py_DECREF(vertex);
+            }
+        } else {
+            for (k = csg->v[i]; k < csg->v[i] + csg->d[i]; k++) {
+                if ((vertex = PyLong_FromLong(csg->e[k])) == NULL ||
+                        PyList_Append(adjlist, vertex) < 0) {
+                    Py_XDECREF(vertex);
+                    Py_DECREF(adjlist);
+                    goto fail;
+                }
+                Py_DECREF(vertex);
+            }
+        }
+        if ((vertex = PyLong_FromLong(i)) == NULL ||
+                PyDict_SetItem(adjdict, vertex, adjlist) < 0) {
+            Py_XDECREF(vertex);
+            Py_DECREF(adjlist);
+            goto fail;
+        }
+        Py_DECREF(vertex);
+        Py_DECREF(adjlist);
+    }
+    return adjdict;
+
+fail:
+    Py_DECREF(adjdict);
+    return NULL;
+}
+
+
+static PyObject* canonical_coloring(PyObject *py_graph)
+// The vertex coloring of the canonical graph of py_graph.  nauty only
+// permutes lab within the cells, so canonical vertices take the colors
+// in order: the first part gets vertices 0, 1, ... and so on.
+{
+    PyObject *partition;
+    PyObject *coloring;
+    PyObject *part;
+    PyObject *vertex;
+    Py_ssize_t no_parts, size, i, j, x;
+
+    if ((partition = PyObject_GetAttrString(py_graph, "vertex_coloring"))
+            == NULL) {
+        return NULL;
+    }
+    if ((no_parts = PyObject_Length(partition)) < 0 ||
+            (coloring = PyList_New(no_parts)) == NULL) {
+        Py_DECREF(partition);
+        return NULL;
+    }
+    for (i = x = 0; i < no_parts; i++) {
+        if ((size = PyObject_Length(PyList_GET_ITEM(partition, i))) < 0 ||
+                (part = PySet_New(NULL)) == NULL) {
+            goto fail;
+        }
+        PyList_SET_ITEM(coloring, i, part);
+        for (j = 0; j < size; j++, x++) {
+            if ((vertex = PyLong_FromSsize_t(x)) == NULL ||
+                    PySet_Add(part, vertex) < 0) {
+                Py_XDECREF(vertex);
+                goto fail;
+            }
+            Py_DECREF(vertex);
+        }
+    }
+    Py_DECREF(partition);
+    return coloring;
+
+fail:
+    Py_DECREF(partition);
+    Py_DECREF(coloring);
+    return NULL;
+}
+
+
+static char graph_canongraph_docs[] =
+"graph_canongraph(g, mode='dense'): \n\
+    Return the canonically labeled version of NyGraph 'g', including\n\
+    its vertex coloring, as a new object of the same type.\n";
+
+static PyObject*
+graph_canongraph(PyObject *self, PyObject *args)
+{
+    PyObject *py_graph;
+    NyGraph * g;
+    PyObject *adjdict;
+    PyObject *coloring = NULL;
+    PyObject *ctor_args = NULL;
+    PyObject *ctor_kwargs = NULL;
+    PyObject *pyret = NULL;
+    const char *mode = "dense";
+
+    if (!PyArg_ParseTuple(args, "O|s", &py_graph, &mode)) {
+        PyErr_SetString(PyExc_TypeError, "Missing argument.");
+        return NULL;
+    }
+    g = _make_nygraph(py_graph, parse_mode(mode));
+    if (g == NULL) return NULL;
+    if (g->no_base_vertices < g->no_vertices) {
+        PyErr_SetString(PyExc_ValueError,
+                "graph_canongraph() does not take edge colors");
+        release_nygraph(g);
+        return NULL;
+    }
+
+    g->options->getcanon = TRUE;
+    if (extend_canonical(g) == NULL) {
+        PyErr_SetString(PyExc_MemoryError,
+                "Allocating canonical matrix failed");
+        release_nygraph(g);
+        return NULL;
+    }
+    // the produced generators are ignored
+    g->options->userautomproc = NULL;
+
+    // *** nauty ***
+    if (run_nauty(g) < 0) {
+        release_nygraph(g);
+        return NULL;
+    }
+
+    adjdict = canonical_adjacency(g);
+    if (adjdict == NULL ||
+            (coloring = canonical_coloring(py_graph)) == NULL ||
+            (ctor_args = Py_BuildValue("(i)", g->no_vertices)) == NULL ||
+            (ctor_kwargs = Py_BuildValue("{s:O,s:O,s:O}",
+                "directed", g->options->digraph ? Py_True : Py_False,
+                "adjacency_dict", adjdict,
+                "vertex_coloring", coloring)) == NULL) {
+        goto done;
+    }
+    pyret = PyObject_Call((PyObject *) Py_TYPE(py_graph),
+            ctor_args, ctor_kwargs);
+
+done:
+    release_nygraph(g);
+    Py_XDECREF(adjdict);
+    Py_XDECREF(coloring);
+    Py_XDECREF(ctor_args);
+    Py_XDECREF(ctor_kwargs);
+    return pyret;
+}
+
+
+static void level0_partition(NyGraph *g, int *lab, int *ptn)
+// Copy the coloring of g into (lab, ptn), the unit partition if none.
+{
+    int i;
+
+    if (g->options->defaultptn) {
+        for (i = 0; i < g->no_vertices; i++) {
+            lab[i] = i;
+            ptn[i] = 1;
+        }
+        if (g->no_vertices > 0) ptn[g->no_vertices-1] = 0;
+    } else {
+        memcpy(lab, g->lab, g->no_vertices * sizeof(int));
+        memcpy(ptn, g->ptn, g->no_vertices * sizeof(int));
+    }
+}
+
+
+static int vertex_degree(NyGraph *g, int v)
+// The (out)degree of vertex v of g.
+{
+    if (g->mode == NY_DENSE) {
+        return setsize(GRAPHROW(g->matrix, v, g->no_setwords),
+                g->no_setwords);
+    }
+    return g->sg.d[v];
+}
+
+
+static boolean same_degrees(NyGraph *a, int *lab_a, NyGraph *b, int *lab_b,
+        int *ptn, int *work)
+// Do the cells of the partitions (lab_a, ptn) of a and (lab_b, ptn) of
+// b have the same multisets of degrees?  work must hold 2n ints.
+{
+    int *deg_a = work, *deg_b = work + a->no_vertices;
+    int i, start;
+
+    for (i = start = 0; i < a->no_vertices; i++) {
+        deg_a[i] = vertex_degree(a, lab_a[i]);
+        deg_b[i] = vertex_degree(b, lab_b[i]);
+        if (ptn[i] == 0) {
+            qsort(deg_a + start, i + 1 - start, sizeof(int), compare_ints);
+            qsort(deg_b + start, i + 1 - start, sizeof(int), compare_ints);
+            start = i + 1;
         }
     }
+    return memcmp(deg_a, deg_b, a->no_vertices * sizeof(int)) == 0;
+}
 
-    Py_DECREF(adjdict);
 
-    // take care of coloring
-    x = set_partition(py_graph, g->lab, g->ptn);
-    if (x < 0) {
-        g->options->defaultptn = TRUE;
-    } else if (x == 0) {
-        return 0;
+static int refine_partition(NyGraph *g, int *lab, int *ptn, int *count,
+        set *active, int *code)
+// Refine (lab, ptn) to the coarsest equitable partition finer than it
+// with the refinement procedure of nauty, and return the number of
+// cells.  code is set to the invariant computed along the way.
+{
+    int n = g->no_vertices;
+    int m = SETWORDSNEEDED(n);
+    int i, numcells = 0;
+
+    EMPTYSET(active, m);
+    for (i = 0; i < n; i++) {
+        if (i == 0 || ptn[i-1] == 0) {
+            ADDELEMENT(active, i);
+            numcells++;
+        }
+    }
+    if (g->mode == NY_DENSE) {
+        refine(g->matrix, lab, ptn, 0, &numcells, count, active, code, m, n);
     } else {
-        g->options->defaultptn = FALSE;
+        refine_sg((graph *) &g->sg, lab, ptn, 0, &numcells, count, active,
+                code, m, n);
     }
-
-    return g;
+    return numcells;
 }
 
 
-// Exported (module level) Python functions ----------------------------------
+static int distinguished(NyGraph *a, NyGraph *b)
+// Cheap isomorphism invariants to compare before the searches: sizes
+// of the color cells, degrees in the cells, then the cells and the
+// code of the equitable refinement of the coloring.  Return 1 if a and
+// b are told apart, 0 if not, or -1 with MemoryError set.
+{
+    int n = a->no_vertices;
+    int m = SETWORDSNEEDED(n);
+    setword *block;
+    int *work;
+    int *lab_a, *ptn_a, *lab_b, *ptn_b, *count;
+    set *active;
+    int cells_a, cells_b, code_a, code_b;
+    int result = 1;
+    int i;
 
-static char make_nygraph_docs[] =
-"make_nygraph(g): \n\
-    Convert the Python NyGraph object into a Nauty/C NyGraph object.\n\
-    Return a handle to the Nauty/C NyGraph object as a PyCObject.\n";
+    // the setwords first, so that they are aligned
+    block = malloc(m * sizeof(setword) + (7 * (size_t) n + 1) * sizeof(int));
+    if (block == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    active = (set *) block;
+    work = (int *) (block + m);
+    lab_a = work + 2 * n;
+    ptn_a = lab_a + n;
+    lab_b = ptn_a + n;
+    ptn_b = lab_b + n;
+    count = ptn_b + n;
 
-static PyObject*
-make_nygraph(PyObject *self, PyObject *args)
-// Convert the Python NyGraph object into a Nauty/C NyGraph object
-// and set Nauty options.
-{
-    PyObject * py_graph;
-    NyGraph * g;
+    level0_partition(a, lab_a, ptn_a);
+    level0_partition(b, lab_b, ptn_b);
+    if (memcmp(ptn_a, ptn_b, n * sizeof(int)) != 0) goto done;
+    if (!same_degrees(a, lab_a, b, lab_b, ptn_a, work)) goto done;
 
-    if (!PyArg_ParseTuple(args, "O", &py_graph)) {
-        PyErr_SetString(PyExc_TypeError, "Missing argument.");
-        return NULL;
+    cells_a = refine_partition(a, lab_a, ptn_a, count, active, &code_a);
+    cells_b = refine_partition(b, lab_b, ptn_b, count, active, &code_b);
+    if (cells_a != cells_b || code_a != code_b ||
+            memcmp(ptn_a, ptn_b, n * sizeof(int)) != 0) {
+        goto done;
+    }
+    // the cells are equitable, so their first vertices will do
+    for (i = 0; i < n; i++) {
+        if ((i == 0 || ptn_a[i-1] == 0) &&
+                vertex_degree(a, lab_a[i]) != vertex_degree(b, lab_b[i])) {
+            goto done;
+        }
     }
+    result = 0;
+
+done:
+    free(block);
+    return result;
+}
 
-    g = _make_nygraph(py_graph);
-    if (g == NULL) return NULL;
 
-    //return PyCObject_FromVoidPtr((void *) g, NULL);
-    return PyCapsule_New((void *) g, NULL, NULL);
+static boolean same_canonical(NyGraph *a, NyGraph *b)
+// Are the canonical graphs of a and b, of the same mode, equal?
+{
+    int i;
+
+    if (a->mode == NY_DENSE) {
+        return memcmp(a->cmatrix, b->cmatrix,
+                (size_t) a->no_vertices * a->no_setwords * sizeof(setword))
+            == 0;
+    }
+    sortlists_sg(&a->csg);
+    sortlists_sg(&b->csg);
+    if (a->csg.nde != b->csg.nde ||
+            memcmp(a->csg.d, b->csg.d, a->no_vertices * sizeof(int)) != 0) {
+        return FALSE;
+    }
+    for (i = 0; i < a->no_vertices; i++) {
+        if (memcmp(a->csg.e + a->csg.v[i], b->csg.e + b->csg.v[i],
+                    a->csg.d[i] * sizeof(int)) != 0) {
+            return FALSE;
+        }
+    }
+    return TRUE;
 }
 
 
-static char delete_nygraph_docs[] =
-"delete_nygraph(g): \n\
-    Free the allocated memory for Nauty NyGraph.\n";
+static char graph_isomorphism_docs[] =
+"graph_isomorphism(a, b, mode='dense'): \n\
+    Return an isomorphism from NyGraph 'a' to NyGraph 'b' as a list,\n\
+    or None if they are not isomorphic.\n";
 
 static PyObject*
-delete_nygraph(PyObject *self, PyObject *args) {
-    PyObject *p;
-    NyGraph *g;
+graph_isomorphism(PyObject *self, PyObject *args)
+{
+    PyObject *py_a, *py_b;
+    NyGraph *a, *b;
+    PyObject *pyret = NULL;
+    PyObject *vertex;
+    const char *mode = "dense";
+    int i;
 
-    if (!PyArg_ParseTuple(args, "O", &p)) {
+    if (!PyArg_ParseTuple(args, "OO|s", &py_a, &py_b, &mode)) {
         PyErr_SetString(PyExc_TypeError, "Missing argument.");
         return NULL;
     }
+    if ((a = _make_nygraph(py_a, parse_mode(mode))) == NULL) return NULL;
+    if ((b = _make_nygraph(py_b, parse_mode(mode))) == NULL) {
+        release_nygraph(a);
+        return NULL;
+    }
 
-    //g = (NyGraph *) PyCObject_AsVoidPtr(p);
-    g = (NyGraph *) PyCapsule_GetPointer(p, NULL);
-    destroy_nygraph(g);
-    return Py_BuildValue("");
+    // mode='auto' decides on invariants, so it may tell a and b apart
+    if (a->no_vertices != b->no_vertices || a->mode != b->mode ||
+            a->no_base_vertices != b->no_base_vertices) {
+        goto none;
+    }
+    if ((i = distinguished(a, b)) < 0) goto done;
+    if (i > 0) goto none;
+
+    a->options->getcanon = b->options->getcanon = TRUE;
+    if (extend_canonical(a) == NULL || extend_canonical(b) == NULL) {
+        PyErr_SetString(PyExc_MemoryError,
+                "Allocating canonical matrix failed");
+        goto done;
+    }
+    // the produced generators are ignored
+    a->options->userautomproc = b->options->userautomproc = NULL;
+
+    // *** nauty ***
+    if (run_nauty(a) < 0 || run_nauty(b) < 0) goto done;
+
+    if (!same_canonical(a, b)) goto none;
+
+    // vertex lab[k] of either graph is vertex k of the canonical graph,
+    // in layer 0 for k < no_base_vertices if the graphs were layered
+    if ((pyret = PyList_New(a->no_base_vertices)) == NULL) goto done;
+    for (i = 0; i < a->no_base_vertices; i++) {
+        if ((vertex = PyLong_FromLong(b->lab[i])) == NULL) {
+            Py_CLEAR(pyret);
+            goto done;
+        }
+        PyList_SET_ITEM(pyret, a->lab[i], vertex);
+    }
+    goto done;
+
+none:
+    Py_INCREF(Py_None);
+    pyret = Py_None;
+
+done:
+    release_nygraph(a);
+    release_nygraph(b);
+    return pyret;
 }
 
 
-static char graph_autgrp_docs[] =
-"graph_autgrp(g):\n\
-    Return the (generators, order, orbits, orbit_no)\n\
-    of the automorphism group of NyGraph 'g'.\n";
+static char graph_analyze_docs[] =
+"graph_analyze(g, want, mode='dense', format='raw'): \n\
+    Return a dict of the results of a single search on NyGraph 'g':\n\
+    'gens', 'orbits', 'canon', 'cert', 'stats' and 'order', those\n\
+    listed in 'want'.\n";
 
 static PyObject*
-graph_autgrp(PyObject *self, PyObject *args)
+graph_analyze(PyObject *self, PyObject *args)
 {
+    static const char *names[] = {"gens", "orbits", "canon", "cert", "stats",
+        "order"};
+    enum {GENS = 1, ORBITS = 2, CANON = 4, CERT = 8, STATS = 16, ORDER = 32};
     PyObject *py_graph;
+    PyObject *py_want;
+    PyObject *seq;
+    PyObject *item;
     NyGraph * g;
     PyObject *pyret;
+    PyObject *value;
+    const char *mode = "dense";
+    const char *format = "raw";
+    const char *name;
+    int fmt, want = 0;
+    Py_ssize_t i;
+    int j;
 
-    if (!PyArg_ParseTuple(args, "O", &py_graph)) {
-        PyErr_SetString(PyExc_TypeError, "Missing argument.");
+    if (!PyArg_ParseTuple(args, "OO|ss", &py_graph, &py_want,
+                &mode, &format)) {
         return NULL;
     }
-    g = _make_nygraph(py_graph);
-    if (g == NULL) return NULL;
+    if ((fmt = parse_format(format)) < 0) {
+        PyErr_Format(PyExc_ValueError,
+                "unknown certificate format '%s'", format);
+        return NULL;
+    }
+    if ((seq = PySequence_Fast(py_want, "a sequence of names expected"))
+            == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < PySequence_Fast_GET_SIZE(seq); i++) {
+        item = PySequence_Fast_GET_ITEM(seq, i);
+        if ((name = PyUnicode_AsUTF8(item)) == NULL) {
+            Py_DECREF(seq);
+            return NULL;
+        }
+        for (j = 0; j < 6 && strcmp(name, names[j]) != 0; j++);
+        if (j == 6) {
+            PyErr_Format(PyExc_ValueError, "unknown result '%s'", name);
+            Py_DECREF(seq);
+            return NULL;
+        }
+        want |= 1 << j;
+    }
+    Py_DECREF(seq);
 
-    // compute automorphism group only
-    g->options->getcanon = FALSE;
-    g->options->userautomproc = store_generator;
+    g = _make_nygraph(py_graph, parse_mode(mode));
+    if (g == NULL) return NULL;
 
-    // initialize storage for collecting generators
-    if ((g->generator = malloc(NUM_GENS_INCR * sizeof(permutation*)))
-            == NULL) {
+    // the canonical labeling only if asked for, it costs extra
+    g->options->getcanon = (want & (CANON | CERT)) ? TRUE : FALSE;
+    if (g->options->getcanon && extend_canonical(g) == NULL) {
         PyErr_SetString(PyExc_MemoryError,
-                "Initial generator list allocation failed.");
+                "Allocating canonical matrix failed");
+        release_nygraph(g);
         return NULL;
     }
-    g->max_no_generators = NUM_GENS_INCR;
-    
+    g->options->userautomproc = (want & GENS) ? store_generator : NULL;
+
     // *** nauty ***
-    // compute automorphism group
-    nauty(g->matrix, g->lab, g->ptn, NULL, g->orbits,
-            g->options, g->stats,  g->workspace, g->worksize,
-            g->no_setwords, g->no_vertices, NULL);
-    
-    pyret = py_auto_group(g);
-    destroy_nygraph(g);
+    pyret = NULL;
+    if (run_nauty(g) < 0) goto done;
+
+    if ((pyret = PyDict_New()) == NULL) goto done;
+    for (j = 0; j < 6; j++) {
+        if (!(want & (1 << j))) continue;
+        switch (1 << j) {
+        case GENS:
+            value = py_generators(g);
+            break;
+        case ORBITS:
+            value = py_int_list(g->orbits, g->no_base_vertices);
+            break;
+        case CANON:
+            value = py_int_list(g->lab, g->no_base_vertices);
+            break;
+        case CERT:
+            value = g->mode != NY_DENSE ? sparse_certificate(g, fmt) :
+                dense_certificate(g->cmatrix, g->no_setwords,
+                        g->no_vertices, g->options->digraph, fmt);
+            break;
+        case STATS:
+            value = py_stats(g);
+            break;
+        default:
+            value = py_group_order(g);
+            break;
+        }
+        if (value == NULL || PyDict_SetItemString(pyret, names[j], value)) {
+            Py_XDECREF(value);
+            Py_CLEAR(pyret);
+            goto done;
+        }
+        Py_DECREF(value);
+    }
+
+done:
+    release_nygraph(g);
     return pyret;
 }
 
 
-static char graph_cert_docs[] =
-"graph_cert(g): \n\
-    Return the unique certificate of NyGraph 'g'.\n";
+static char check_edge_array_docs[] =
+"check_edge_array(n, edges): \n\
+    Check an (E, 2) edge array or an (indptr, indices) pair of arrays\n\
+    for a graph on 'n' vertices and return the number of edges.\n";
 
 static PyObject*
-graph_cert(PyObject *self, PyObject *args)
+check_edge_array(PyObject *self, PyObject *args)
 {
-    PyObject *py_graph;
-    NyGraph * g;
-    PyObject *pyret;
+    PyObject *edges;
+    long n;
+    int *pairs;
+    size_t no_pairs;
 
-    if (!PyArg_ParseTuple(args, "O", &py_graph)) {
-        PyErr_SetString(PyExc_TypeError, "Missing argument.");
+    if (!PyArg_ParseTuple(args, "lO", &n, &edges)) return NULL;
+    if (n < 0 || n > INT_MAX / 2) {
+        PyErr_SetString(PyExc_ValueError, "invalid number_of_vertices");
         return NULL;
     }
-    g = _make_nygraph(py_graph);
-    if (g == NULL) return NULL;
+    if (read_edge_array(edges, n, &pairs, &no_pairs, 0) < 0) return NULL;
+    free(pairs);
+    return PyLong_FromSize_t(no_pairs);
+}
 
-    // produce graph certificate by computing canonical labeling
-    g->options->getcanon = TRUE;
-    if (extend_canonical(g) == NULL) {
-        PyErr_SetString(PyExc_MemoryError,
-                "Allocating canonical matrix failed");
+
+static char check_colors_docs[] =
+"check_colors(n, colors): \n\
+    Check an array of the colors of the 'n' vertices of a graph and\n\
+    return the number of distinct colors.\n";
+
+static PyObject*
+check_colors(PyObject *self, PyObject *args)
+{
+    PyObject *colors;
+    int *array;
+    int n, k;
+
+    if (!PyArg_ParseTuple(args, "iO", &n, &colors)) return NULL;
+    if (n < 0 || n > INT_MAX / 2) {
+        PyErr_SetString(PyExc_ValueError, "invalid number_of_vertices");
         return NULL;
     }
-    // the produced generators are ignored
-    g->options->userautomproc = NULL;
+    if ((array = malloc((n + 1) * sizeof(int))) == NULL) {
+        return PyErr_NoMemory();
+    }
+    k = read_colors(colors, n, array);
+    free(array);
+    if (k < 0) return NULL;
+    return PyLong_FromLong(k);
+}
 
-    // *** nauty ***
-    nauty(g->matrix, g->lab, g->ptn, NULL, g->orbits,
-            g->options, g->stats,  g->workspace, g->worksize,
-            g->no_setwords, g->no_vertices, g->cmatrix);
 
-#if PY_MAJOR_VERSION >= 3
-    pyret = Py_BuildValue("y#", g->cmatrix,
-            g->no_vertices * g->no_setwords * sizeof(setword));
-#else
-    pyret = Py_BuildValue("s#", g->cmatrix,
-            g->no_vertices * g->no_setwords * sizeof(setword));
-#endif
-    destroy_nygraph(g);
-    return pyret;
+static char clear_cache_docs[] =
+"clear_cache(): \n\
+    Free the Nauty NyGraph objects kept for reuse between calls.\n";
+
+static PyObject*
+clear_cache(PyObject *self, PyObject *args)
+{
+    while (NYGRAPH_POOL_LENGTH > 0) {
+        destroy_nygraph(NYGRAPH_POOL[--NYGRAPH_POOL_LENGTH]);
+    }
+    return Py_BuildValue("");
 }
 
-static char graph_canonlab_docs[] =
-"graph_canonlab(g): \n\
-    Return the canonical relabelling of NyGraph 'g'.\n";
+static char graph_certs_docs[] =
+"graph_certs(graphs, threads=1, format='raw'): \n\
+    Return the list of certificates of the NyGraph objects in 'graphs'\n\
+    computed by 'threads' threads without holding the GIL.\n";
 
 static PyObject*
-graph_canonlab(PyObject *self, PyObject *args)
+graph_certs(PyObject *self, PyObject *args)
 {
+    PyObject *py_graphs;
+    PyObject *seq;
+    PyObject *pyret = NULL;
+    PyObject *cert;
+    NyBatch b;
+    NyPacked *p;
+    int no_threads = 1;
+    const char *format = "raw";
+    int fmt;
     int i;
-    PyObject *py_graph;
-    NyGraph * g;
-    PyObject *pyret;
 
-    if (!PyArg_ParseTuple(args, "O", &py_graph)) {
-        PyErr_SetString(PyExc_TypeError, "Missing argument.");
+    if (!PyArg_ParseTuple(args, "O|is", &py_graphs, &no_threads, &format)) {
+        return NULL;
+    }
+    if ((fmt = parse_format(format)) < 0) {
+        PyErr_Format(PyExc_ValueError,
+                "unknown certificate format '%s'", format);
+        return NULL;
+    }
+    if ((seq = PySequence_Fast(py_graphs, "an iterable of graphs expected"))
+            == NULL) {
         return NULL;
     }
-    g = _make_nygraph(py_graph);
-    if (g == NULL) return NULL;
 
-    // produce graph certificate by computing canonical labeling
-    g->options->getcanon = TRUE;
-    if (extend_canonical(g) == NULL) {
-        PyErr_SetString(PyExc_MemoryError,
-                "Allocating canonical matrix failed");
+    b.no_graphs = PySequence_Fast_GET_SIZE(seq);
+    b.max_vertices = 1;
+    b.next = b.no_done = 0;
+    b.graphs = calloc(b.no_graphs + 1, sizeof(NyPacked *));
+    b.results = calloc(b.no_graphs + 1, sizeof(char *));
+    if (b.graphs == NULL || b.results == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    if ((pyret = PyList_New(b.no_graphs)) == NULL) goto done;
+    for (i = 0; i < b.no_graphs; i++) {
+        if ((b.graphs[i] = pack_graph(PySequence_Fast_GET_ITEM(seq, i)))
+                == NULL) {
+            Py_CLEAR(pyret);
+            goto done;
+        }
+        if (b.graphs[i]->no_vertices > b.max_vertices) {
+            b.max_vertices = b.graphs[i]->no_vertices;
+        }
+        // nauty writes straight into the bytes objects: they are
+        // not visible to any other Python code until we return
+        cert = PyBytes_FromStringAndSize(NULL,
+                (Py_ssize_t) b.graphs[i]->no_vertices *
+                ((b.graphs[i]->no_vertices + WORDSIZE - 1) / WORDSIZE) *
+                sizeof(setword));
+        if (cert == NULL) {
+            Py_CLEAR(pyret);
+            goto done;
+        }
+        PyList_SET_ITEM(pyret, i, cert);
+        b.results[i] = PyBytes_AS_STRING(cert);
+    }
+
+    if (b.no_graphs > 0) {
+        pthread_mutex_init(&b.lock, NULL);
+        Py_BEGIN_ALLOW_THREADS
+        run_batch(&b, no_threads);
+        Py_END_ALLOW_THREADS
+        pthread_mutex_destroy(&b.lock);
+        if (b.no_done < b.no_graphs) {
+            PyErr_SetString(PyExc_MemoryError,
+                    "Nauty NyGraph creation failed");
+            Py_CLEAR(pyret);
+        }
+    }
+
+    // re-encode the canonical matrices if another format was asked for
+    for (i = 0; pyret != NULL && fmt != NY_CERT_RAW && i < b.no_graphs; i++) {
+        p = b.graphs[i];
+        cert = dense_certificate(
+                (graph *) PyBytes_AS_STRING(PyList_GET_ITEM(pyret, i)),
+                (p->no_vertices + WORDSIZE - 1) / WORDSIZE,
+                p->no_vertices, p->digraph, fmt);
+        if (cert == NULL) {
+            Py_CLEAR(pyret);
+            break;
+        }
+        PyList_SetItem(pyret, i, cert);
+    }
+
+done:
+    if (b.graphs != NULL) {
+        for (i = 0; i < b.no_graphs; i++) destroy_packed(b.graphs[i]);
+    }
+    free(b.graphs);
+    free(b.results);
+    Py_DECREF(seq);
+    return pyret;
+}
+
+static char pack_graphs_docs[] =
+"pack_graphs(graphs, kind): \n\
+    Pack the NyGraph objects in 'graphs' into one byte string, their\n\
+    adjacency lists in CSR form, for run_packed() to compute results\n\
+    of the given kind: 0 certificates, 1 canonical labelings or\n\
+    2 orbits.  Return (packed, offsets): the result of graph i goes to\n\
+    bytes offsets[i] to offsets[i+1] of the output buffer.\n";
+
+static PyObject*
+pack_graphs(PyObject *self, PyObject *args)
+// The packed batch is a header of size_t values: the number of
+// graphs, the size of the largest one, the kind of results, then the
+// byte offsets of the graphs and of their results, one more than
+// graphs each.  Graph i is the ints n, digraph, colored, indptr[n+1],
+// heads[indptr[n]] and, if colored, lab[n] and ptn[n].
+{
+    PyObject *py_graphs;
+    PyObject *seq;
+    PyObject *packed = NULL;
+    PyObject *offsets = NULL;
+    PyObject *pyret = NULL;
+    NyPacked **graphs = NULL;
+    NyPacked *p;
+    size_t *header, *graph_at, *result_at;
+    size_t size, k;
+    int *indptr, *heads;
+    int kind, no_graphs, max_vertices = 1;
+    int i, n, v;
+
+    if (!PyArg_ParseTuple(args, "Oi", &py_graphs, &kind)) return NULL;
+    if (kind < NY_PACKED_CERT || kind > NY_PACKED_ORBITS) {
+        PyErr_SetString(PyExc_ValueError, "unknown kind of results");
         return NULL;
     }
-    // the produced generators are ignored
+    if ((seq = PySequence_Fast(py_graphs, "an iterable of graphs expected"))
+            == NULL) {
+        return NULL;
+    }
+    no_graphs = PySequence_Fast_GET_SIZE(seq);
+    if ((graphs = calloc(no_graphs + 1, sizeof(NyPacked *))) == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    size = (3 + 2 * ((size_t) no_graphs + 1)) * sizeof(size_t);
+    for (i = 0; i < no_graphs; i++) {
+        if ((p = pack_graph(PySequence_Fast_GET_ITEM(seq, i))) == NULL) {
+            goto done;
+        }
+        graphs[i] = p;
+        if (p->no_vertices > max_vertices) max_vertices = p->no_vertices;
+        size += (4 + (size_t) p->no_vertices + p->no_edges +
+                (p->colored ? 2 * (size_t) p->no_vertices : 0)) * sizeof(int);
+    }
+    if ((packed = PyBytes_FromStringAndSize(NULL, size)) == NULL) goto done;
+
+    header = (size_t *) PyBytes_AS_STRING(packed);
+    header[0] = no_graphs;
+    header[1] = max_vertices;
+    header[2] = kind;
+    graph_at = header + 3;
+    result_at = graph_at + no_graphs + 1;
+    graph_at[0] = (3 + 2 * ((size_t) no_graphs + 1)) * sizeof(size_t);
+    result_at[0] = 0;
+    for (i = 0; i < no_graphs; i++) {
+        p = graphs[i];
+        n = p->no_vertices;
+        indptr = (int *) ((char *) header + graph_at[i]);
+        indptr[0] = n;
+        indptr[1] = p->digraph;
+        indptr[2] = p->colored;
+        indptr += 3;
+        heads = indptr + n + 1;
+
+        // counting sort of the arcs by tail: indptr[v] is the end of
+        // the arcs from v once they are placed, then shifted back
+        memset(indptr, 0, (n + 1) * sizeof(int));
+        for (k = 0; k < p->no_edges; k++) indptr[p->edges[2*k] + 1]++;
+        for (v = 0; v < n; v++) indptr[v+1] += indptr[v];
+        for (k = 0; k < p->no_edges; k++) {
+            heads[indptr[p->edges[2*k]]++] = p->edges[2*k+1];
+        }
+        for (v = n; v > 0; v--) indptr[v] = indptr[v-1];
+        indptr[0] = 0;
+
+        if (p->colored) {
+            memcpy(heads + p->no_edges, p->lab, n * sizeof(int));
+            memcpy(heads + p->no_edges + n, p->ptn, n * sizeof(int));
+        }
+        graph_at[i+1] = graph_at[i] + (4 + (size_t) n + p->no_edges +
+                (p->colored ? 2 * (size_t) n : 0)) * sizeof(int);
+        result_at[i+1] = result_at[i] + (kind == NY_PACKED_CERT ?
+                (size_t) n * ((n + WORDSIZE - 1) / WORDSIZE) * sizeof(setword) :
+                (size_t) n * sizeof(int));
+    }
+
+    if ((offsets = PyList_New(no_graphs + 1)) == NULL) goto done;
+    for (i = 0; i <= no_graphs; i++) {
+        PyObject *x = PyLong_FromSize_t(result_at[i]);
+        if (x == NULL) goto done;
+        PyList_SET_ITEM(offsets, i, x);
+    }
+    pyret = Py_BuildValue("(OO)", packed, offsets);
+
+done:
+    if (graphs != NULL) {
+        for (i = 0; i < no_graphs; i++) destroy_packed(graphs[i]);
+    }
+    free(graphs);
+    Py_XDECREF(packed);
+    Py_XDECREF(offsets);
+    Py_DECREF(seq);
+    return pyret;
+}
+
+
+static void unpack_record(NyGraph *g, int *record, boolean getcanon)
+// Load graph record of a packed batch into g, see pack_graphs(),
+// like unpack_graph() does with a NyPacked graph.
+{
+    int n = record[0];
+    int *indptr = record + 3;
+    int *heads = indptr + n + 1;
+    int i, k;
+
+    g->no_vertices = n;
+    g->no_setwords = (n + WORDSIZE - 1) / WORDSIZE;
+    for (i = 0; i < n; i++) {
+        EMPTYSET((GRAPHROW(g->matrix, i, g->no_setwords)), g->no_setwords);
+    }
+    g->options->digraph = record[1];
+    for (i = 0; i < n; i++) {
+        for (k = indptr[i]; k < indptr[i+1]; k++) make_edge(g, i, heads[k]);
+    }
+
+    if (record[2]) {
+        memcpy(g->lab, heads + indptr[n], n * sizeof(int));
+        memcpy(g->ptn, heads + indptr[n] + n, n * sizeof(int));
+        g->options->defaultptn = FALSE;
+    } else {
+        g->options->defaultptn = TRUE;
+    }
+    g->options->getcanon = getcanon;
     g->options->userautomproc = NULL;
+}
 
-    // *** nauty ***
-    nauty(g->matrix, g->lab, g->ptn, NULL, g->orbits,
-            g->options, g->stats,  g->workspace, g->worksize,
-            g->no_setwords, g->no_vertices, g->cmatrix);
 
-    pyret = PyList_New(g->no_vertices);
-    for (i=0; i < g->no_vertices; i++) {
-        PyList_SetItem(pyret, i, Py_BuildValue("i", g->lab[i]));
+static int check_record(Py_buffer *packed, size_t at, int max_vertices,
+        size_t result_size, int kind, char *seen)
+// Check that the graph record at byte offset at of a packed batch
+// lies within the buffer, its vertices within max_vertices and its
+// result_size matches, so that unpack_record() and the search stay in
+// bounds.  seen is scratch space of max_vertices chars.  Return 0, or
+// -1 with ValueError set.
+{
+    size_t len = packed->len / sizeof(int);
+    int *record;
+    int *indptr, *heads;
+    int n, m, v;
+    size_t k, size;
+
+    if (at % sizeof(int) != 0 || at / sizeof(int) + 3 > len) goto bad;
+    record = (int *) ((char *) packed->buf + at);
+    len -= at / sizeof(int);
+    n = record[0];
+    if (n < 0 || n > max_vertices || (record[1] & ~1) || (record[2] & ~1) ||
+            (size_t) n + 1 > len - 3) {
+        goto bad;
+    }
+    indptr = record + 3;
+    heads = indptr + n + 1;
+    if (indptr[0] != 0) goto bad;
+    for (v = 0; v < n; v++) {
+        if (indptr[v+1] < indptr[v]) goto bad;
+    }
+    size = 3 + (size_t) n + 1 + indptr[n] + (record[2] ? 2 * (size_t) n : 0);
+    if (size > len) goto bad;
+    for (k = 0; k < (size_t) indptr[n]; k++) {
+        if (heads[k] < 0 || heads[k] >= n) goto bad;
+    }
+    if (record[2] && n > 0) {
+        // lab is a permutation, ptn ends the last cell
+        memset(seen, 0, n);
+        for (v = 0; v < n; v++) {
+            if (heads[indptr[n] + v] < 0 || heads[indptr[n] + v] >= n ||
+                    seen[heads[indptr[n] + v]]++) {
+                goto bad;
+            }
+        }
+        if (heads[indptr[n] + 2 * n - 1] != 0) goto bad;
+    }
+
+    m = (n + WORDSIZE - 1) / WORDSIZE;
+    if (result_size != (kind == NY_PACKED_CERT ?
+                (size_t) n * m * sizeof(setword) : (size_t) n * sizeof(int))) {
+        goto bad;
     }
+    return 0;
 
-    destroy_nygraph(g);
+bad:
+    PyErr_SetString(PyExc_ValueError, "not a packed batch of graphs");
+    return -1;
+}
+
+
+static char run_packed_docs[] =
+"run_packed(packed, start, stop, out): \n\
+    Compute the results of graphs start to stop-1 of a batch made by\n\
+    pack_graphs(), reading it from the buffer 'packed' and writing\n\
+    into the writable buffer 'out', without holding the GIL.\n";
+
+static PyObject*
+run_packed(PyObject *self, PyObject *args)
+{
+    PyObject *py_packed, *py_out;
+    PyObject *pyret = NULL;
+    Py_buffer packed, out;
+    size_t *header, *graph_at, *result_at;
+    NyGraph *g = NULL;
+    char *seen = NULL;
+    long start, stop, i;
+    int kind;
+
+    if (!PyArg_ParseTuple(args, "OllO", &py_packed, &start, &stop, &py_out)) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(py_packed, &packed, PyBUF_SIMPLE) < 0) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(py_out, &out, PyBUF_WRITABLE) < 0) {
+        PyBuffer_Release(&packed);
+        return NULL;
+    }
+
+    // the buffer may come from anywhere: check everything the searches
+    // will touch before they run
+    header = (size_t *) packed.buf;
+    if ((size_t) packed.buf % sizeof(size_t) != 0 ||
+            packed.len < (Py_ssize_t) (5 * sizeof(size_t)) ||
+            header[0] > (size_t) packed.len / (2 * sizeof(size_t)) ||
+            packed.len < (Py_ssize_t) ((3 + 2 * (header[0] + 1)) *
+                sizeof(size_t)) ||
+            header[1] < 1 || header[1] > (size_t) packed.len / sizeof(int) ||
+            header[1] > INT_MAX ||
+            header[2] > NY_PACKED_ORBITS) {
+        PyErr_SetString(PyExc_ValueError, "not a packed batch of graphs");
+        goto done;
+    }
+    kind = header[2];
+    graph_at = header + 3;
+    result_at = graph_at + header[0] + 1;
+    if (start < 0 || stop < start || (size_t) stop > header[0]) {
+        PyErr_SetString(PyExc_IndexError, "graph index out of range");
+        goto done;
+    }
+    for (i = start; i < stop; i++) {
+        if (result_at[i+1] < result_at[i]) {
+            PyErr_SetString(PyExc_ValueError, "not a packed batch of graphs");
+            goto done;
+        }
+    }
+    if ((size_t) out.len < result_at[stop]) {
+        PyErr_SetString(PyExc_ValueError, "output buffer too small");
+        goto done;
+    }
+    if ((seen = malloc(header[1])) == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    for (i = start; i < stop; i++) {
+        if (check_record(&packed, graph_at[i], header[1],
+                    result_at[i+1] - result_at[i], kind, seen) < 0) {
+            goto done;
+        }
+    }
+
+    if ((g = create_nygraph(header[1], NY_DENSE)) == NULL ||
+            (kind != NY_PACKED_ORBITS && extend_canonical(g) == NULL)) {
+        PyErr_SetString(PyExc_MemoryError, "Nauty NyGraph creation failed");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    for (i = start; i < stop; i++) {
+        unpack_record(g, (int *) ((char *) header + graph_at[i]),
+                kind != NY_PACKED_ORBITS);
+        search_nygraph(g);
+        memcpy((char *) out.buf + result_at[i],
+                kind == NY_PACKED_CERT ? (void *) g->cmatrix :
+                kind == NY_PACKED_LABEL ? (void *) g->lab : (void *) g->orbits,
+                result_at[i+1] - result_at[i]);
+    }
+    // the caller may be a short-lived thread of a pool
+    free_thread_arrays();
+    Py_END_ALLOW_THREADS
+    pyret = Py_BuildValue("");
+
+done:
+    if (g != NULL) destroy_nygraph(g);
+    free(seen);
+    PyBuffer_Release(&out);
+    PyBuffer_Release(&packed);
     return pyret;
 }
 
@@ -598,6 +4807,20 @@ static PyMethodDef nautywrap_methods[] = {
     {"graph_cert", graph_cert, METH_VARARGS, graph_cert_docs},
     {"graph_canonlab", graph_canonlab, METH_VARARGS, graph_canonlab_docs},
     {"graph_autgrp", graph_autgrp, METH_VARARGS, graph_autgrp_docs},
+    {"graph_certs", graph_certs, METH_VARARGS, graph_certs_docs},
+    {"pack_graphs", pack_graphs, METH_VARARGS, pack_graphs_docs},
+    {"run_packed", run_packed, METH_VARARGS, run_packed_docs},
+    {"graph_mode", graph_mode, METH_VARARGS, graph_mode_docs},
+    {"graph_key", graph_key, METH_VARARGS, graph_key_docs},
+    {"graph_canongraph", graph_canongraph, METH_VARARGS,
+        graph_canongraph_docs},
+    {"graph_isomorphism", graph_isomorphism, METH_VARARGS,
+        graph_isomorphism_docs},
+    {"graph_analyze", graph_analyze, METH_VARARGS, graph_analyze_docs},
+    {"check_edge_array", check_edge_array, METH_VARARGS,
+        check_edge_array_docs},
+    {"check_colors", check_colors, METH_VARARGS, check_colors_docs},
+    {"clear_cache", clear_cache, METH_NOARGS, clear_cache_docs},
     {"make_nygraph", make_nygraph, METH_VARARGS, make_nygraph_docs},
     {"delete_nygraph", delete_nygraph, METH_VARARGS, delete_nygraph_docs},
     {NULL}
@@ -617,15 +4840,55 @@ PyObject *
 PyInit_nautywrap(void) {
     PyObject *m;
 
+    if (PyType_Ready(&NyCompactType) < 0) return NULL;
+    if (PyType_Ready(&NyHandleType) < 0) return NULL;
+    if (PyType_Ready(&NyIntArrayType) < 0) return NULL;
+    if (NyStatsType.tp_name == NULL &&
+            PyStructSequence_InitType2(&NyStatsType, &stats_desc) < 0) {
+        return NULL;
+    }
     m = PyModule_Create(&moduledef);
+    if (m == NULL) return NULL;
+    Py_INCREF(&NyCompactType);
+    if (PyModule_AddObject(m, "CompactGraph",
+                (PyObject *) &NyCompactType) < 0) {
+        Py_DECREF(&NyCompactType);
+        Py_DECREF(m);
+        return NULL;
+    }
+    Py_INCREF(&NyHandleType);
+    if (PyModule_AddObject(m, "Handle", (PyObject *) &NyHandleType) < 0) {
+        Py_DECREF(&NyHandleType);
+        Py_DECREF(m);
+        return NULL;
+    }
+    Py_INCREF(&NyStatsType);
+    if (PyModule_AddObject(m, "SearchStats", (PyObject *) &NyStatsType) < 0) {
+        Py_DECREF(&NyStatsType);
+        Py_DECREF(m);
+        return NULL;
+    }
     return m;
 #else
 void
 initnautywrap(void) {
     PyObject *m;
 
+    if (PyType_Ready(&NyCompactType) < 0) return;
+    if (PyType_Ready(&NyHandleType) < 0) return;
+    if (PyType_Ready(&NyIntArrayType) < 0) return;
+    if (NyStatsType.tp_name == NULL) {
+        PyStructSequence_InitType(&NyStatsType, &stats_desc);
+    }
     m = Py_InitModule3("nautywrap", nautywrap_methods,
             "Graph (auto/iso)morphism wrapper for nauty");
+    if (m == NULL) return;
+    Py_INCREF(&NyCompactType);
+    PyModule_AddObject(m, "CompactGraph", (PyObject *) &NyCompactType);
+    Py_INCREF(&NyHandleType);
+    PyModule_AddObject(m, "Handle", (PyObject *) &NyHandleType);
+    Py_INCREF(&NyStatsType);
+    PyModule_AddObject(m, "SearchStats", (PyObject *) &NyStatsType);
 #endif
 }
 
@@ -13,10 +13,60 @@ GNU General Public License for more details.
 */
 
 
+#include <ctype.h>
+#include <errno.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
 #include <nauty.h>
+#include <nausparse.h>
+#include <nautinv.h>
+#include <schreier.h>
+#include <traces.h>
+#include <gtools.h>
 
 #define WORKSPACE_FACTOR    66
-#define NUM_GENS_INCR      500
+#define NUM_GENS_INIT       16
+
+// seconds between checks for Python signals, like Ctrl-C, while nauty
+// runs without the GIL
+#define SIGNAL_CHECK_INTERVAL   0.1
+
+// why a search was cut short
+#define NY_ABORT_NODES          1   // max_nodes exceeded
+#define NY_ABORT_TIMEOUT        2   // the timeout expired
+#define NY_ABORT_EXCEPTION      3   // a signal handler or callback raised
+#define NY_ABORT_INTERRUPTED    4   // stopped for another search after
+                                    // streaming generators
+
+// NyGraph objects kept for reuse between calls, at most
+// NYGRAPH_POOL_SIZE of them with no more than NYGRAPH_POOL_MAX_VERTICES
+#define NYGRAPH_POOL_SIZE               8
+#define NYGRAPH_POOL_MAX_VERTICES    1024
+
+// the search engines a NyGraph can be handed to
+#define NY_DENSE            0   // nauty() on the adjacency matrix
+#define NY_SPARSE           1   // sparsenauty() on a sparsegraph
+#define NY_TRACES           2   // Traces() on a sparsegraph
+#define NY_AUTO             3   // one of the above chosen per graph
+
+// certificate formats
+#define NY_CERT_RAW         0   // canonical adjacency matrix or lists
+#define NY_CERT_EDGES       1   // sorted canonical edge list
+#define NY_CERT_SPARSE6     2   // sparse6 (digraph6 if directed) string
+#define NY_CERT_HASH128     3   // 4 hashgraph() values of 32 bits
+#define NY_CERT_HASH256     4   // 8 hashgraph() values of 32 bits
+
+// the results run_packed() writes for each graph of a packed batch
+#define NY_PACKED_CERT      0   // the canonical adjacency matrix
+#define NY_PACKED_LABEL     1   // the canonical labeling
+#define NY_PACKED_ORBITS    2   // the orbits of the automorphism group
+
+// thresholds of the NY_AUTO policy, see choose_mode()
+#define AUTO_SMALL_VERTICES        16   // always dense up to this
+#define AUTO_DENSE_MAX_VERTICES 50000   // never dense above this
+#define AUTO_THIN_MIN_VERTICES    256   // sparse engine for larger graphs
+#define AUTO_THIN_MAX_DEGREE        8   //   with a lower average degree
 
 //  a compound data structure to hold all the nauty data structures
 //  which describe/used for computing with a given graph
@@ -24,25 +74,160 @@ GNU General Public License for more details.
 typedef struct {
     optionblk *options;
     
+    int         mode;
     int         no_vertices;
     int         no_setwords;
-    // adjacency matrix as a bit-array
+    // the vertices of the graph given: fewer than no_vertices if its
+    // edge colors were encoded in layers, see layer_nygraph(); the
+    // results are reported for these vertices only
+    int         no_base_vertices;
+    // NY_DENSE: adjacency matrix as a bit-array
     setword     *matrix;
-    // adjacency matrix for the canonical graph
+    // NY_DENSE: adjacency matrix for the canonical graph
     setword     *cmatrix;
+    // NY_SPARSE, NY_TRACES: the graph and the canonical graph
+    sparsegraph sg;
+    sparsegraph csg;
     // coloring: represented as 0-level partition of vertices
     int         *lab;
     int         *ptn;
+    // lab then ptn saved while searching, to restart a search that
+    // another thread killed with nauty_kill_request
+    int         *saved_partition;
    // orbits under Autgrp
     int         *orbits;
 
-    // list of generators of Autgrp
+    // generators of Autgrp stored one after the other
+    // in a single block with room for max_no_generators
     int max_no_generators;
     int no_generators;
-    permutation **generator;
+    permutation *generators;
+    // some generators were dropped since the block could not grow
+    boolean     generators_lost;
+
+    // the index of each level of the first path of the search tree,
+    // the product is the exact group order (nauty only, not Traces)
+    int no_levels;
+    int *level_index;
+
+    // nauty's schreier_fails() setting when options->schreier is set,
+    // 0 for its default
+    int         schreier_fails;
 
     statsblk    *stats;
+    // the wall clock and CPU seconds the last search took
+    double      search_time;
+    double      search_cpu_time;
     int         worksize;
     setword     *workspace;
 } NyGraph;
 
+//  the state of a single nauty() call, reachable from nauty's callbacks
+
+typedef struct {
+    // the graph being searched
+    NyGraph     *graph;
+    // where the generators go instead of graph->generators, if set:
+    // a Python callable, called holding the GIL, or the slots of a
+    // buffer of no_slots generators, filled cyclically
+    PyObject    *callback;
+    int         *slots;
+    long        no_slots;
+    // the generators streamed so far
+    long        no_streamed;
+    // the exception a signal handler or the callback raised
+    PyObject    *exc_type, *exc_value, *exc_traceback;
+    // the budget of the search, 0 for none: search tree nodes, and
+    // seconds
+    unsigned long max_nodes;
+    double      timeout;
+    // whether to run the Python signal handlers now and then
+    boolean     check_signals;
+    double      checked;
+    unsigned long no_nodes;
+    // NY_ABORT_* if the search was cut short, 0 otherwise
+    volatile int aborted;
+    // this search has set nauty_kill_request
+    boolean     killing;
+} NySearch;
+
+//  a thread stopping a search when its timeout expires
+
+typedef struct {
+    NySearch    *search;
+    pthread_t   thread;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    // the search is over
+    boolean     done;
+} NyWatchdog;
+
+//  a graph converted from Python, ready to be loaded into a NyGraph
+//  without holding the GIL
+
+typedef struct {
+    int         no_vertices;
+    boolean     digraph;
+    boolean     colored;
+    // edges as (tail, head) pairs
+    size_t      no_edges;
+    int         *edges;
+    // coloring, if any, stored behind the edges in the same allocation
+    int         *lab;
+    int         *ptn;
+} NyPacked;
+
+//  a list of graphs processed by a pool of threads
+
+typedef struct {
+    int         no_graphs;
+    NyPacked    **graphs;
+    // the size of the largest graph, for sizing the per-thread buffers
+    int         max_vertices;
+    // result buffers, one per graph
+    char        **results;
+
+    pthread_mutex_t lock;
+    // index of the next unprocessed graph
+    int         next;
+    int         no_done;
+} NyBatch;
+
+//  the compact graph type: adjacency lists in CSR form and a color
+//  array in a single allocation
+
+typedef struct {
+    PyObject_HEAD
+    int         no_vertices;
+    boolean     directed;
+    // parts of the vertex coloring, 0 if the graph is not colored
+    int         no_colors;
+    // the heads of the arcs from vertex v, sorted and without
+    // duplicates, are heads[indptr[v]] ... heads[indptr[v+1]-1]
+    int         *indptr;
+    int         *heads;
+    // the part of each vertex, NULL if not colored
+    int         *colors;
+} NyCompact;
+
+//  a persistent dense NyGraph edited edge by edge between searches
+
+typedef struct {
+    PyObject_HEAD
+    NyGraph     *graph;         // NULL once released
+    // the level 0 partition, lab then ptn, restored before each
+    // search since nauty overwrites it; NULL if the graph is uncolored
+    int         *partition;
+    // a search is running without the GIL
+    boolean     busy;
+} NyHandle;
+
+//  an int array owned by Python, exported with the buffer protocol
+
+typedef struct {
+    PyObject_HEAD
+    int         *data;
+    int         ndim;
+    Py_ssize_t  shape[2];
+    Py_ssize_t  strides[2];
+} NyIntArray;
@@ -0,0 +1,25 @@
+#!/usr/bin/env python
+
+from pynauty import Graph, autgrp, certificate, canon_label, clear_cache
+from pynauty import Version
+import pytest
+
+
+def cycle(n):
+    return Graph(n, adjacency_dict={i: [(i + 1) % n] for i in range(n)})
+
+
+def test_clear_cache():
+    print(Version())
+    print('Testing pynauty.clear_cache()')
+    # more sizes than data structures kept for reuse
+    graphs = [cycle(n) for n in range(3, 40)] + [cycle(2000)]
+    results = [(autgrp(g), certificate(g), canon_label(g)) for g in graphs]
+    for i in range(2):
+        for g, (aut, cert, label) in zip(graphs, results):
+            assert autgrp(g) == aut
+            assert certificate(g) == cert
+            assert canon_label(g) == label
+        clear_cache()
+    for g, (aut, cert, label) in zip(graphs, results):
+        assert aut[1] == 2 * g.number_of_vertices
@@ -0,0 +1,95 @@
+#!/usr/bin/env python
+
+import multiprocessing
+import random
+from pynauty import (Graph, CompactGraph, CertCache, certificate,
+                     canon_label)
+import pytest
+
+
+def random_graph(rng, n, p=0.3, cls=Graph, **kwargs):
+    adj = {v: [w for w in range(n) if w != v and rng.random() < p]
+           for v in range(n)}
+    return cls(n, adjacency_dict=adj, **kwargs)
+
+
+@pytest.mark.parametrize('shared', [False, True])
+def test_cert_cache(shared):
+    print('Testing pynauty.CertCache, shared=%s' % shared)
+    rng = random.Random(5)
+    graphs = [random_graph(rng, 12) for _ in range(10)]
+    cache = CertCache(1024, shared=shared)
+    for g in graphs + graphs:
+        assert certificate(g, cache=cache) == certificate(g)
+        assert canon_label(g, cache=cache) == canon_label(g)
+        assert (certificate(g, 'sparse', 'edges', cache=cache) ==
+                certificate(g, 'sparse', 'edges'))
+    assert cache.misses == 30 and cache.hits == 30
+    assert len(cache) == 30
+
+    # a copy hits, an edit, a coloring or a direction misses
+    g = graphs[0]
+    assert certificate(g.copy(), cache=cache) == certificate(g)
+    assert certificate(CompactGraph(12, False, g.adjacency_dict),
+                       cache=cache) == certificate(g)
+    assert cache.hits == 32
+    h = g.copy()
+    h.connect_vertex(0, [v for v in range(1, 12)])
+    colored = g.copy()
+    colored.set_vertex_coloring([{0}])
+    directed = Graph(12, True, g.adjacency_dict)
+    for x in h, colored, directed:
+        assert certificate(x, cache=cache) == certificate(x)
+    assert cache.hits == 32 and cache.misses == 33
+
+    cache.clear()
+    assert len(cache) == 0 and cache.hits == 0 and cache.misses == 0
+
+
+def test_cert_cache_eviction():
+    print('Testing pynauty.CertCache eviction')
+    rng = random.Random(6)
+    graphs = [random_graph(rng, 8) for _ in range(5)]
+    cache = CertCache(4)
+    for g in graphs:
+        certificate(g, cache=cache)
+    assert len(cache) == 4
+    # graphs[0] was dropped, graphs[1] is kept and made recent
+    certificate(graphs[1], cache=cache)
+    certificate(graphs[0], cache=cache)
+    assert cache.hits == 1 and cache.misses == 6
+    certificate(graphs[1], cache=cache)
+    assert cache.hits == 2
+
+    # too large for a slot, never stored
+    cache = CertCache(4, shared=True, slot_size=64)
+    g = random_graph(rng, 30)
+    assert certificate(g, cache=cache) == certificate(g, cache=cache)
+    assert len(cache) == 0 and cache.misses == 2
+
+
+# inherited by the forked workers
+_FORKED = {}
+
+
+def _fork_worker(i):
+    cache, graphs = _FORKED['args']
+    return certificate(graphs[i], cache=cache)
+
+
+@pytest.mark.skipif('fork' not in multiprocessing.get_all_start_methods(),
+                    reason='needs fork')
+def test_cert_cache_fork():
+    print('Testing pynauty.CertCache shared by forked processes')
+    rng = random.Random(7)
+    graphs = [random_graph(rng, 10) for _ in range(6)]
+    cache = CertCache(32, shared=True)
+    for g in graphs[:3]:
+        certificate(g, cache=cache)
+    _FORKED['args'] = (cache, graphs)
+    with multiprocessing.get_context('fork').Pool(2) as pool:
+        certs = pool.map(_fork_worker, range(len(graphs)))
+    _FORKED.clear()
+    assert certs == [certificate(g) for g in graphs]
+    assert cache.hits == 3 and cache.misses == 6
+    assert len(cache) == 6
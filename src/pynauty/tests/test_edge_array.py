@@ -0,0 +1,125 @@
+#!/usr/bin/env python
+
+import array
+import pickle
+import random
+from pynauty import Graph, autgrp, certificate, certificates, canon_label
+import pytest
+
+
+def random_edges(n, m, rng):
+    return [(rng.randrange(n), rng.randrange(n)) for i in range(m)]
+
+
+def from_edges(n, edges, directed=False):
+    adjacency_dict = {}
+    for x, y in edges:
+        adjacency_dict.setdefault(x, []).append(y)
+    return Graph(n, directed=directed, adjacency_dict=adjacency_dict)
+
+
+def pair_array(edges, typecode='i'):
+    flat = array.array(typecode, [v for e in edges for v in e])
+    return memoryview(flat).cast('B').cast(typecode, (len(edges), 2))
+
+
+def csr_arrays(n, edges, typecode='q'):
+    rows = [[] for x in range(n)]
+    for x, y in edges:
+        rows[x].append(y)
+    indptr = [0]
+    for ys in rows:
+        indptr.append(indptr[-1] + len(ys))
+    return (array.array(typecode, indptr),
+            array.array(typecode, [y for ys in rows for y in ys]))
+
+
+@pytest.mark.parametrize('mode', ['dense', 'sparse', 'auto'])
+@pytest.mark.parametrize('directed', [False, True])
+def test_edge_array(mode, directed):
+    print('Testing Graph.from_edge_array() with mode=%s' % mode)
+    rng = random.Random(4)
+    n = 40
+    edges = random_edges(n, 90, rng)
+    g = from_edges(n, edges, directed)
+    for arrays in (pair_array(edges), pair_array(edges, 'q'),
+                   csr_arrays(n, edges), csr_arrays(n, edges, 'i')):
+        h = Graph.from_edge_array(n, arrays, directed=directed)
+        assert autgrp(h, mode)[1:] == autgrp(g, mode)[1:]
+        assert canon_label(h, mode) == canon_label(g, mode)
+        assert certificate(h, mode) == certificate(g, mode)
+        assert certificates([h]) == [certificate(g)]
+        assert h.adjacency_dict == g.adjacency_dict
+
+
+def test_edge_array_errors():
+    print('Testing Graph.from_edge_array() errors')
+    with pytest.raises(ValueError):
+        Graph.from_edge_array(3, pair_array([(0, 1), (1, 3)]))
+    with pytest.raises(ValueError):
+        Graph.from_edge_array(3, pair_array([(0, 1), (-1, 2)]))
+    with pytest.raises(ValueError):
+        Graph.from_edge_array(3, array.array('i', [0, 1, 1, 2]))
+    with pytest.raises(ValueError):
+        Graph.from_edge_array(3, (array.array('i', [0, 2, 1, 3]),
+                                  array.array('i', [1, 2, 0])))
+    with pytest.raises(TypeError):
+        Graph.from_edge_array(3, array.array('d', [0, 1, 1, 2]))
+    # unsigned 64 bit vertices out of range are not wrapped around
+    for v in (2**63 + 1, 2**64 - 1, 2**32 + 1):
+        with pytest.raises(ValueError):
+            Graph.from_edge_array(3, pair_array([(0, 1), (v, 2)], 'Q'))
+        with pytest.raises(ValueError):
+            Graph.from_edge_array(3, (array.array('Q', [0, 1, v, 2]),
+                                      array.array('Q', [1, 2])))
+    assert certificate(Graph.from_edge_array(
+        3, pair_array([(0, 1), (1, 2)], 'Q'))) == \
+        certificate(Graph(3, adjacency_dict={0: [1], 1: [2]}))
+
+
+def test_edge_array_copy():
+    print('Testing copies of Graphs made from edge arrays')
+    rng = random.Random(5)
+    n = 20
+    edges = random_edges(n, 40, rng)
+    g = from_edges(n, edges)
+    cert = certificate(g)
+    colors = array.array('i', [v % 3 for v in range(n)])
+    colored = certificate(Graph(n, adjacency_dict=g.adjacency_dict,
+                                vertex_coloring=colors))
+    for arrays in (pair_array(edges), csr_arrays(n, edges)):
+        h = Graph.from_edge_array(n, arrays)
+        copies = [h.copy(), pickle.loads(pickle.dumps(h))]
+        k = Graph.from_edge_array(n, arrays,
+                                  vertex_coloring=memoryview(colors))
+        copies_k = [k.copy(), pickle.loads(pickle.dumps(k))]
+        # the Graph aliases the arrays, its copies do not
+        flat = arrays[1] if isinstance(arrays, tuple) else \
+            arrays.cast('B').cast('i')
+        saved = list(flat)
+        for i in range(len(flat)):
+            flat[i] = 0
+        colors[0] = 2
+        assert certificate(h) != cert
+        assert all(certificate(c) == cert for c in copies)
+        assert all(certificate(c) == colored for c in copies_k)
+        for i, x in enumerate(saved):
+            flat[i] = x
+        colors[0] = 0
+        assert all(c.adjacency_dict == g.adjacency_dict for c in copies)
+
+
+def test_numpy():
+    np = pytest.importorskip('numpy')
+    print('Testing Graph.from_edge_array() with NumPy arrays')
+    rng = random.Random(6)
+    n = 1000
+    edges = random_edges(n, 3000, rng)
+    g = from_edges(n, edges)
+    h = Graph.from_edge_array(n, np.array(edges, dtype=np.int64))
+    c = certificate(g, 'sparse', 'hash128')
+    assert certificate(h, 'sparse', 'hash128') == c
+    indptr, indices = csr_arrays(n, edges)
+    h = Graph.from_edge_array(n, (np.array(indptr, dtype=np.int32),
+                                  np.array(indices, dtype=np.int32)))
+    assert certificate(h, 'sparse', 'hash128') == c
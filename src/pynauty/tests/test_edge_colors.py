@@ -0,0 +1,179 @@
+#!/usr/bin/env python
+
+import random
+from pynauty import (Graph, Handle, autgrp, certificate, certificates,
+                     parallel_map, canon_label, canon_graph, isomorphic,
+                     isomorphism)
+import pytest
+
+MODES = ['dense', 'sparse', 'traces', 'auto']
+
+
+def relabel(g, perm):
+    # vertex v of g is vertex perm[v] of the result
+    adj = {perm[v]: [perm[w] for w in ws]
+           for v, ws in g.adjacency_dict.items()}
+    coloring = [set(perm[v] for v in part) for part in g.vertex_coloring]
+    colors = {(perm[x], perm[y]): c for (x, y), c in g.edge_colors.items()}
+    return Graph(g.number_of_vertices, g.directed, adj, coloring, colors)
+
+
+def random_colored(rng, n, directed=False, p=0.4, max_color=5):
+    adj = {v: [w for w in range(n) if w != v and rng.random() < p]
+           for v in range(n)}
+    colors = {}
+    for v, ws in adj.items():
+        for w in ws:
+            if (directed or v < w) and rng.random() < 0.5:
+                colors[v, w] = rng.randint(1, max_color)
+    return Graph(n, directed, adj, edge_colors=colors)
+
+
+def cycle(n, colors={}):
+    return Graph(n, adjacency_dict={v: [(v + 1) % n] for v in range(n)},
+                 edge_colors=colors)
+
+
+def colored_edges(g):
+    # every arc with its color, both ways round if undirected
+    edges = {}
+    for v, ws in g.adjacency_dict.items():
+        for w in ws:
+            edges[v, w] = 1
+    edges.update(g.edge_colors)
+    if not g.directed:
+        edges.update({(w, v): c for (v, w), c in edges.items()})
+    return edges
+
+
+@pytest.mark.parametrize('mode', MODES)
+def test_edge_colors_group(mode):
+    print('Testing edge colors in autgrp(), mode=%s' % mode)
+    # a hexagon with one double bond keeps only the reflection through it
+    g = cycle(6, {(0, 1): 2})
+    gens, order, _, orbits, no_orbits = autgrp(g, mode)
+    assert order == 2 and no_orbits == 3
+    assert orbits == [0, 0, 2, 3, 3, 2]
+    for perm in gens:
+        assert len(perm) == 6
+        assert colored_edges(relabel(g, perm)) == colored_edges(g)
+    generators = autgrp(g, mode, as_array=True)[0]
+    assert memoryview(generators).tolist() == gens
+    assert memoryview(generators).shape == (len(gens), 6)
+
+    # alternating bonds: the rotations by two and three reflections
+    g = cycle(6, {(0, 1): 2, (2, 3): 2, (4, 5): 2})
+    assert autgrp(g, mode)[1] == 6
+    # the colors only reduce the group of the plain cycle
+    assert autgrp(cycle(6), mode)[1] == 12
+
+    seen = []
+    autgrp(g, mode, on_generator=lambda p: seen.append(list(p)))
+    assert all(len(p) == 6 for p in seen)
+
+
+@pytest.mark.parametrize('mode', MODES)
+@pytest.mark.parametrize('directed', [False, True])
+def test_edge_colors_canon(mode, directed):
+    print('Testing edge colors in certificate() and canon_label(), '
+          'mode=%s, directed=%s' % (mode, directed))
+    if directed and mode == 'traces':
+        pytest.skip('Traces does not support directed graphs')
+    rng = random.Random(11)
+    for _ in range(10):
+        g = random_colored(rng, 12, directed)
+        perm = list(range(12))
+        rng.shuffle(perm)
+        h = relabel(g, perm)
+        assert certificate(g, mode) == certificate(h, mode)
+        assert canon_graph(g, mode).edge_colors == \
+            canon_graph(h, mode).edge_colors
+        lab = canon_label(g, mode)
+        assert sorted(lab) == list(range(12))
+
+        # a color above the others changes the certificate
+        e = next(iter(g.edge_colors))
+        k = g.copy()
+        k.edge_colors[e] = 8
+        assert certificate(k, mode) != certificate(g, mode)
+
+
+def test_edge_colors_canon_graph():
+    print('Testing canon_graph() of an edge colored graph')
+    g = cycle(5, {(1, 2): 3})
+    g.set_vertex_coloring([{0}])
+    c = canon_graph(g)
+    lab = canon_label(g)
+    position = {v: i for i, v in enumerate(lab)}
+    assert c.edge_colors == {(position[1], position[2]): 3}
+    assert c.vertex_coloring[0] == {position[0]}
+    assert certificate(c) == certificate(g)
+    assert canon_graph(c).adjacency_dict == c.adjacency_dict
+    assert canon_graph(c).edge_colors == c.edge_colors
+
+
+def test_multigraph():
+    print('Testing multigraphs as edge colors')
+    # two vertices joined by one or two edges, and loops
+    single = Graph(2, adjacency_dict={0: [1]})
+    double = Graph(2, edge_colors={(0, 1): 2})
+    assert certificate(single) != certificate(double)
+    assert autgrp(double)[1] == 2
+
+    # the listed edges are edges, and an undirected edge may be given
+    # either way round
+    a = Graph(4, edge_colors={(0, 1): 2, (1, 2): 1, (2, 3): 3})
+    b = Graph(4, edge_colors={(3, 2): 2, (2, 1): 1, (1, 0): 3})
+    assert isomorphic(a, b)
+    m = isomorphism(a, b)
+    assert m == [3, 2, 1, 0]
+    assert not isomorphic(a, Graph(4, edge_colors={(0, 1): 2, (1, 2): 3,
+                                                   (2, 3): 1}))
+
+    # directed arcs keep their direction, loops their color
+    d = Graph(3, True, edge_colors={(0, 1): 2, (1, 2): 2, (2, 0): 2})
+    assert autgrp(d)[1] == 3
+    assert autgrp(Graph(3, True, edge_colors={(0, 1): 2, (1, 2): 2,
+                                              (2, 0): 1}))[1] == 1
+    loops = Graph(3, adjacency_dict={0: [1, 2]},
+                  edge_colors={(1, 1): 2, (2, 2): 2})
+    assert autgrp(loops)[1] == 2
+    loops.set_edge_colors({(1, 1): 2, (2, 2): 3})
+    assert autgrp(loops)[1] == 1
+
+
+def test_edge_colors_isomorphism():
+    print('Testing isomorphism() of edge colored graphs')
+    rng = random.Random(12)
+    for directed in False, True:
+        g = random_colored(rng, 15, directed)
+        perm = list(range(15))
+        rng.shuffle(perm)
+        h = relabel(g, perm)
+        m = isomorphism(g, h)
+        assert m is not None and len(m) == 15
+        assert colored_edges(relabel(g, m)) == colored_edges(h)
+        assert isomorphic(g, h)
+        k = h.copy()
+        k.edge_colors[0, 0] = 6
+        assert not isomorphic(g, k)
+
+
+def test_edge_colors_errors():
+    print('Testing edge color errors')
+    with pytest.raises(ValueError):
+        Graph(3, edge_colors={(0, 1): 0})
+    with pytest.raises(ValueError):
+        Graph(3, edge_colors={(0, 3): 1})
+    g = Graph(3, edge_colors={(0, 1): 1, (1, 0): 2})
+    with pytest.raises(ValueError):
+        certificate(g)
+    g = Graph(3, edge_colors={(0, 1): 2})
+    with pytest.raises(ValueError):
+        Handle(g)
+    with pytest.raises(ValueError):
+        certificates([g])
+    with pytest.raises(ValueError):
+        parallel_map(certificate, [g])
+    assert 'edge_colors' in repr(g)
+    assert g.copy().edge_colors == g.edge_colors
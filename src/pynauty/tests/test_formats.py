@@ -0,0 +1,64 @@
+#!/usr/bin/env python
+
+import random
+import struct
+from pynauty import Graph, certificate, certificates
+import pytest
+
+FORMATS = ['raw', 'edges', 'sparse6', 'hash128', 'hash256']
+
+
+def random_graph(n, p, rng, directed=False):
+    return Graph(n, directed=directed, adjacency_dict={
+        i: [j for j in range(n) if j != i and rng.random() < p]
+        for i in range(n)})
+
+
+def relabel(g, perm):
+    return Graph(g.number_of_vertices, directed=g.directed,
+                 adjacency_dict={perm[x]: [perm[y] for y in ys]
+                                 for x, ys in g.adjacency_dict.items()})
+
+
+@pytest.mark.parametrize('mode', ['dense', 'sparse', 'traces'])
+@pytest.mark.parametrize('format', FORMATS)
+def test_formats(mode, format):
+    print('Testing pynauty.certificate() with format=%s' % format)
+    rng = random.Random(11)
+    for n in (0, 1, 7, 70):
+        g = random_graph(n, 0.3, rng)
+        h = relabel(g, rng.sample(range(n), n))
+        c = certificate(g, mode, format)
+        assert certificate(h, mode, format) == c
+        if format != 'raw':
+            assert certificates([g, h], format=format) == \
+                [certificate(g, 'dense', format)] * 2
+        if n < 2:
+            continue
+        g.connect_vertex(0, [v for v in range(1, n)
+                             if v not in g.adjacency_dict.get(0, [])])
+        assert certificate(g, mode, format) != c
+
+
+def test_compact():
+    print('Testing the size of compact certificates')
+    rng = random.Random(5)
+    n = 500
+    g = random_graph(n, 0.004, rng)
+    edges = certificate(g, format='edges')
+    pairs = struct.iter_unpack('ii', edges)
+    assert sorted(pairs) == list(struct.iter_unpack('ii', edges))
+    assert all(i <= j for i, j in struct.iter_unpack('ii', edges))
+    no_edges = len(edges) // struct.calcsize('ii')
+    assert no_edges == len(set((min(x, y), max(x, y))
+                               for x, ys in g.adjacency_dict.items()
+                               for y in ys))
+    s6 = certificate(g, 'sparse', 'sparse6')
+    assert s6.startswith(b':') and len(s6) < len(edges)
+    assert len(certificate(g, format='raw')) > 10 * len(s6)
+    assert len(certificate(g, format='hash128')) == 16
+    assert len(certificate(g, format='hash256')) == 32
+    d = Graph(3, directed=True, adjacency_dict={0: [1], 1: [2]})
+    assert certificate(d, format='sparse6').startswith(b'&')
+    with pytest.raises(ValueError):
+        certificate(g, format='graph7')
@@ -2,7 +2,9 @@
 
 import sys
 import copy
-from pynauty import isomorphic, delete_random_edge, Version, canon_label
+import random
+from pynauty import (Graph, isomorphic, delete_random_edge, Version,
+                     canon_label, canon_graph, certificate, isomorphism)
 import pytest
 
 
@@ -15,7 +17,72 @@ def test_isomorphic(graph):
     sys.stdout.flush()
     x = g.copy()
     assert isomorphic(g,x)
+    assert isomorphism(g, x, 'auto') is not None
     assert canon_label(g) == canon_label(x)
     e = delete_random_edge(x)
     print('    removed random edge {:<13} ...'.format(str(e)), end=' ')
     assert not isomorphic(g,x)
+
+
+@pytest.mark.parametrize('mode', ['dense', 'sparse', 'traces'])
+def test_canon_graph(mode):
+    print('Testing pynauty.canon_graph() with mode=%s' % mode)
+    rng = random.Random(3)
+    n = 40
+    g = Graph(n, adjacency_dict={
+        i: [j for j in range(i + 1, n) if rng.random() < 0.2]
+        for i in range(n)},
+        vertex_coloring=[set(range(0, 30, 3)), set(), set(range(1, 30, 3))])
+    c = canon_graph(g, mode)
+    lab = canon_label(g, mode)
+    inv = {v: i for i, v in enumerate(lab)}
+    edges = set((inv[x], inv[y]) for x, ys in g.adjacency_dict.items()
+                for y in ys)
+    edges |= set((y, x) for x, y in edges)
+    assert set((x, y) for x, ys in c.adjacency_dict.items()
+               for y in ys) == edges
+    assert [set(inv[v] for v in part) for part in g.vertex_coloring] == \
+        c.vertex_coloring
+    perm = rng.sample(range(n), n)
+    h = Graph(n, adjacency_dict={perm[x]: [perm[y] for y in ys]
+                                 for x, ys in g.adjacency_dict.items()},
+              vertex_coloring=[set(perm[v] for v in part)
+                               for part in g.vertex_coloring])
+    assert canon_graph(h, mode).adjacency_dict == c.adjacency_dict
+    assert certificate(c, mode) == certificate(g, mode)
+
+
+@pytest.mark.parametrize('mode', ['dense', 'sparse', 'traces', 'auto'])
+def test_isomorphism(mode):
+    print('Testing pynauty.isomorphism() with mode=%s' % mode)
+    rng = random.Random(8)
+    n = 30
+    g = Graph(n, adjacency_dict={
+        i: [j for j in range(i + 1, n) if rng.random() < 0.3]
+        for i in range(n)}, vertex_coloring=[set(range(10))])
+    perm = rng.sample(range(n), n)
+    h = Graph(n, adjacency_dict={perm[x]: [perm[y] for y in ys]
+                                 for x, ys in g.adjacency_dict.items()},
+              vertex_coloring=[set(perm[v] for v in range(10))])
+    f = isomorphism(g, h, mode)
+    assert sorted(f) == list(range(n))
+    assert all(f[v] in h.vertex_coloring[0] for v in range(10))
+    edges = lambda g: set(frozenset((x, y)) for x, ys in
+                          g.adjacency_dict.items() for y in ys)
+    assert set(frozenset(f[v] for v in e) for e in edges(g)) == edges(h)
+    # a 6-cycle and two triangles are 2-regular, their equitable
+    # partition is a single cell: only the searches tell them apart
+    c6 = Graph(6, adjacency_dict={i: [(i + 1) % 6] for i in range(6)})
+    t2 = Graph(6, adjacency_dict={0: [1, 2], 1: [2], 3: [4, 5], 4: [5]})
+    assert isomorphism(c6, t2, mode) is None
+    # same degrees, but refinement tells them apart: the path 0-...-5
+    # has cells of sizes 2, 2, 2, a triangle and a path 3-4-5 has
+    # cells {3, 5}, {4} and {0, 1, 2}
+    p6 = Graph(6, adjacency_dict={i: [i + 1] for i in range(5)})
+    tp = Graph(6, adjacency_dict={0: [1, 2], 1: [2], 3: [4], 4: [5]})
+    assert isomorphism(p6, tp, mode) is None
+    assert isomorphism(tp, tp.copy(), mode) is not None
+    x = h.copy()
+    v = min(v for v, vs in x.adjacency_dict.items() if vs)
+    x.adjacency_dict[v].pop()
+    assert isomorphism(g, x, mode) is None
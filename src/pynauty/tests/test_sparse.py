@@ -0,0 +1,60 @@
+#!/usr/bin/env python
+
+import sys
+import random
+from pynauty import (Graph, autgrp, certificate, canon_label,
+                     select_mode, Version)
+import pytest
+
+
+def relabel(g, perm):
+    return Graph(g.number_of_vertices, directed=g.directed,
+                 adjacency_dict={perm[x]: [perm[y] for y in ys]
+                                 for x, ys in g.adjacency_dict.items()},
+                 vertex_coloring=[set(perm[x] for x in part)
+                                  for part in g.vertex_coloring])
+
+
+def is_automorphism(g, p):
+    edges = set((x, y) for x, ys in g.adjacency_dict.items() for y in ys)
+    if not g.directed:
+        edges |= set((y, x) for x, y in edges)
+    return set((p[x], p[y]) for x, y in edges) == edges
+
+
+@pytest.mark.parametrize('mode', ['sparse', 'traces', 'auto'])
+def test_sparse(graph, mode):
+    print(Version())
+    print('Testing pynauty.{autgrp(),certificate()} with mode=%s' % mode)
+    gname, g, numorbit, grpsize, gens = graph
+    if mode == 'sparse' and gname in ('bibd-91-10-1', 'levi-r'):
+        pytest.skip('too slow for sparsenauty')
+    print('%-17s ...' % gname, end=' ')
+    sys.stdout.flush()
+    generators, order, o2, orbits, orbit_no = autgrp(g, mode)
+    assert orbit_no == numorbit and order == grpsize
+    assert all(is_automorphism(g, p) for p in generators)
+    perm = list(range(g.number_of_vertices))
+    random.shuffle(perm)
+    h = relabel(g, perm)
+    assert certificate(h, mode) == certificate(g, mode)
+    assert sorted(canon_label(g, mode)) == list(range(g.number_of_vertices))
+
+
+def test_select_mode():
+    print('Testing pynauty.select_mode()')
+    n = 300
+    cycle = Graph(n, adjacency_dict={i: [(i + 1) % n] for i in range(n)})
+    assert select_mode(cycle) == 'traces'
+    cycle.directed = True
+    assert select_mode(cycle) == 'sparse'
+    small = Graph(5, adjacency_dict={0: [1, 2], 1: [3]})
+    assert select_mode(small) == 'dense'
+    rng = random.Random(7)
+    dense = Graph(100, adjacency_dict={
+        i: [j for j in range(i + 1, 100) if rng.random() < 0.5]
+        for i in range(100)})
+    assert select_mode(dense) == 'dense'
+    h = relabel(dense, rng.sample(range(100), 100))
+    assert certificate(h, 'auto') == certificate(dense, 'auto')
+    assert autgrp(dense, 'auto')[4] == autgrp(dense)[4]